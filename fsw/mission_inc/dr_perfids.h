@@ -1,21 +1,28 @@
-/************************************************************************
-** File:
-**   $Id: dr_perfids.h  $
-**
-** Purpose: 
-**  Define Dr Performance IDs
-**
-** Notes:
-**
-*************************************************************************/
-#ifndef _dr_perfids_h_
-#define _dr_perfids_h_
-
-
-#define DR_PERF_ID              93 
-
-#endif /* _dr_perfids_h_ */
-
-/************************/
-/*  End of File Comment */
-/************************/
+/************************************************************************
+** File:
+**   $Id: dr_perfids.h  $
+**
+** Purpose: 
+**  Define Dr Performance IDs
+**
+** Notes:
+**
+*************************************************************************/
+#ifndef _dr_perfids_h_
+#define _dr_perfids_h_
+
+
+#define DR_PERF_ID              93 
+
+/* The stages of a diagnosis wakeup, nested inside DR_PERF_ID */
+#define DR_MANAGE_TBL_PERF_ID   94 /* Table management */
+#define DR_WRT_GATHER_PERF_ID   95 /* Reading the WRT into test results */
+#define DR_SOLVE_PERF_ID        96 /* Solving the d-matrix */
+#define DR_PUBLISH_PERF_ID      97 /* Sending the diagnosis message */
+#define DR_SAVE_PERF_ID         98 /* Writing the results files */
+
+#endif /* _dr_perfids_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
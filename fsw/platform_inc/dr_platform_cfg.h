@@ -0,0 +1,181 @@
+/************************************************************************
+** File:
+**   $Id: dr_platform_cfg.h  $
+**
+** Purpose:
+**  Define the platform configuration parameters for the DR application
+**
+** Notes:
+**  The DR tables are registered at the largest model size given by
+**  DR_MAX_MODEL_TESTS and DR_MAX_MODEL_FAILURE_MODES. At the default
+**  sizes the packed d-matrix table is about 8 KiB and the watchpoint to
+**  test mapping table 15 KiB, within the default cFE table size limit
+**  (CFE_TBL_MAX_SNGL_TABLE_SIZE, 16 KiB). Larger models need a cFE
+**  platform configuration allowing tables that big
+**  (CFE_TBL_MAX_SNGL_TABLE_SIZE and CFE_TBL_BUF_MEMORY_BYTES), and memory
+**  pool blocks as big as the compiled d-matrix bitsets and connected
+**  components (CFE_ES_MAX_BLOCK_SIZE).
+**
+*************************************************************************/
+#ifndef DR_PLATFORM_CFG_H
+#define DR_PLATFORM_CFG_H
+
+/*
+** DR Largest Model Size
+**
+** The largest numbers of tests and failure modes of a model loaded at
+** runtime, from the packed d-matrix table. The DR app sizes its tables,
+** messages and memory pool from these; the actual model size comes from
+** the d-matrix table header.
+**
+** DR_MAX_MODEL_NONZEROS is the largest number of entries set in the
+** d-matrix of a model, which sizes the index arrays of the sparse
+** d-matrix. Real models are very sparse, with a handful of entries per
+** test; a model with more can only use the bitset engines.
+*/
+#ifndef DR_MAX_MODEL_TESTS
+#define DR_MAX_MODEL_TESTS   256
+#endif
+
+#ifndef DR_MAX_MODEL_FAILURE_MODES
+#define DR_MAX_MODEL_FAILURE_MODES   256
+#endif
+
+#ifndef DR_MAX_MODEL_NONZEROS
+#define DR_MAX_MODEL_NONZEROS   4096
+#endif
+
+/*
+** DR Memory Pool Size
+**
+** The size in bytes of the memory pool DR allocates its model buffers
+** from when it registers its tables: for each of the two models the
+** tables are compiled into, the d-matrix row and column bitsets, sparse
+** d-matrix indices, connected components and the gather plan compiled
+** from the watchpoint to test mapping, and the test result buffers.
+** There are two models so a mode change can compile the new mode's
+** tables while the old mode's model is still in use.
+** The default is twice what those need at the largest model size, as
+** the pool rounds each buffer up to one of its block sizes, and gives
+** each a block descriptor.
+*/
+#ifndef DR_MEM_POOL_SIZE
+#define DR_MEM_POOL_SIZE						\
+  (2 * ((2 * DR_MODEL_STORAGE_BYTES(DR_MAX_MODEL_TESTS,			\
+				    DR_MAX_MODEL_FAILURE_MODES,		\
+				    DR_MAX_MODEL_NONZEROS,		\
+				    LC_MAX_WATCHPOINTS)) +		\
+	(2 * ((sizeof(dr_test_result_type) * DR_MAX_MODEL_TESTS) +	\
+	      DR_MODEL_ALIGNMENT))))
+#endif
+
+/*
+** DR Model Cache Size
+**
+** The size in bytes of the memory pool for the model cache. If it is
+** not 0, DR loads the d-matrix and wtm tables of each mode in the mode
+** definition table at startup, and compiles its model into the cache,
+** until the cache is full. Changing to a cached mode then only switches
+** to its model, without loading the tables again; the LC watchpoint
+** definition table is still loaded unless LC already has it. Each cached
+** model takes storage sized to its own d-matrix, plus about 6 KiB at the
+** default largest model size for its connected components.
+**
+** The tables are only read at startup, so table files changed after
+** that only take effect for modes that are not cached, or when the
+** tables are loaded from the ground.
+*/
+#ifndef DR_MODEL_CACHE_SIZE
+#define DR_MODEL_CACHE_SIZE   0
+#endif
+
+/*
+** DR Diagnosis Trigger
+**
+** If DR_DIAGNOSE_ON_LC_SAMPLE is 1, DR subscribes to LC_SAMPLE_AP_MID and
+** diagnoses when the scheduler tells LC to sample its actionpoints,
+** instead of on every DR_WAKEUP_MID. This is a phase-aligned trigger:
+** DR diagnoses from the same watchpoint results LC's actionpoints are
+** evaluated from in that slot of the schedule. It is not a sign that
+** the watchpoint results have changed, since LC updates them whenever
+** a watched message arrives; DR_Diagnose() still sends the last
+** diagnosis again when the test results haven't changed. DR must run at
+** a lower priority than LC, so LC is done with the sample first. LC
+** owns the watchpoint results table and updates it in place, so there
+** is no table update for DR to be notified of.
+**
+** DR_WAKEUP_MID still manages the DR tables, and is a watchdog: if
+** DR_LC_SAMPLE_TIMEOUT_WAKEUPS wakeups pass without a diagnosis, the
+** wakeup diagnoses anyway.
+**
+** If DR_DIAGNOSE_ON_LC_SAMPLE is 0, DR diagnoses on every DR_WAKEUP_MID.
+*/
+#ifndef DR_DIAGNOSE_ON_LC_SAMPLE
+#define DR_DIAGNOSE_ON_LC_SAMPLE   0
+#endif
+
+#ifndef DR_LC_SAMPLE_TIMEOUT_WAKEUPS
+#define DR_LC_SAMPLE_TIMEOUT_WAKEUPS   4
+#endif
+
+/*
+** DR Results Files
+**
+** If DR_RESULTS_LOG_FORMAT is DR_RESULTS_CSV, DR saves each diagnosis as
+** a row of its test results and failure modes CSV files,
+** /cf/dr_test_results.csv and /cf/dr_failure_modes.csv. If it is
+** DR_RESULTS_BINARY, DR saves each diagnosis as a record of the binary
+** log /cf/dr_results.log instead, in the format of dr_log_format.h: the
+** test results and failure modes packed 2 bits each, with the cFE time
+** of the diagnosis, after a header giving the model size, mode and
+** tables, which is written again whenever those change. A record is
+** about a tenth the size of the CSV rows and takes no formatting.
+** The dr_log_convert tool in fsw/tools converts the log to the CSV files.
+**
+** The rows, or records, are built in a buffer of DR_RESULTS_BUFFER_SIZE
+** bytes per file, and written every DR_RESULTS_FLUSH_ROWS rows, or
+** sooner whenever the buffer fills, so a row of the largest model may
+** take a few writes. A record must fit the buffer whole. With more than
+** 1 row per write, that many rows may be lost if DR stops without
+** closing the files.
+*/
+#define DR_RESULTS_CSV      0
+#define DR_RESULTS_BINARY   1
+
+#ifndef DR_RESULTS_LOG_FORMAT
+#define DR_RESULTS_LOG_FORMAT   DR_RESULTS_CSV
+#endif
+
+#ifndef DR_RESULTS_FLUSH_ROWS
+#define DR_RESULTS_FLUSH_ROWS   1
+#endif
+
+#ifndef DR_RESULTS_BUFFER_SIZE
+#define DR_RESULTS_BUFFER_SIZE   8192
+#endif
+
+/*
+** DR Results Log Keyframes
+**
+** Most diagnoses give the same test results and failure modes as the
+** one before, so only every DR_RESULTS_KEYFRAME_INTERVAL-th record of
+** the binary log is a keyframe with all of them. The records between
+** are deltas, which list just the tests and failure modes that changed,
+** 24 bytes when nothing did. A keyframe is also saved at the start of
+** each segment, so on every mode or model change, after a record that
+** couldn't be written, and whenever the delta would be no smaller. A
+** reader rebuilds the values of a delta record from the keyframe
+** before it. With 1, every record is a keyframe.
+**
+** Small records make raising DR_RESULTS_FLUSH_ROWS worthwhile, so the
+** deltas are written a buffer at a time rather than one at a time.
+*/
+#ifndef DR_RESULTS_KEYFRAME_INTERVAL
+#define DR_RESULTS_KEYFRAME_INTERVAL   100
+#endif
+
+#endif /* DR_PLATFORM_CFG_H */
+
+/************************/
+/*  End of File Comment */
+/************************/
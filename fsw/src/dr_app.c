@@ -1,1068 +1,2391 @@
-/*******************************************************************************
-** File: dr_app.c
-**
-** Purpose:
-**   This file contains the source code for the Diagnostic Reasoner.
-**
-*******************************************************************************/
-
-/*
-**   Include Files:
-*/
-
-#include "dr_app.h"
-#include "dr_perfids.h"
-#include "dr_msgids.h"
-
-#include "lc_platform_cfg.h" // for LC_APP_NAME
-#include "lc_app.h" // for LC_WRT_TABLENAME
-
-#include "cfe_tbl_msg.h"
-
-#include "dr_msg.h"
-#include "dr_events.h"
-#include "dr_version.h" 
-#include "dr_mode_def.h"
-#include "dr_d_matrix_tbl.h"
-#include "dr_wtm_tbl.h"
-
-#include "dr_process_tests.h"
-#include "dr_process_d_matrix.h"
-#include "dr_print_results.h"
-#include "dr_save_results.h"
-
-////////////////////////////////////////////////////////
-// Stuff to help debugging/testing
-
-// Uncomment to enable trace messages
-//#define DR_TRACE
-// Hack, here are some other trace messages
-//#define DR_TRACE_SUSPECTS_BADS
-
-// Uncomment to print out timing info to the screen
-//#define DR_TIMING
-
-#ifdef DR_TIMING
-// I would usually put headers farther up but we only need
-// this one for doing the timing...
-// Also, the man page for gettimeofday stated it was obsolete under
-// POSIX 2008, and recommended clock_gettime() instead, so I'm
-// using that. I should test for _POSIX_C_SOURCE >= 199309L to check
-// if it exists, but maybe will do that later...
-#include <time.h>
-struct timespec time_interval(struct timespec start, struct timespec end);
-#endif
-
-/*********************************
-** global data, what isn't shared with other modules is declared static
-*/
-static dr_hk_tlm_type         DR_HkTelemetryPkt;
-static dr_diagnosis_msg_type  DR_Diagnosis_Msg;
-static CFE_SB_PipeId_t        DR_CommandPipe;
-static CFE_SB_MsgPtr_t        DR_MsgPtr;
-
-
-static CFE_EVS_BinFilter_t  DR_EventFilters[] =
-       {  /* Event ID    mask */
-          {DR_STARTUP_INF_EID,       0x0000},
-          {DR_COMMAND_ERR_EID,       0x0000},
-          {DR_COMMANDNOP_INF_EID,    0x0000},
-          {DR_COMMANDRST_INF_EID,    0x0000},
-       };
-
-///////////////////////////////////////////
-// Handles to the various tables and table pointers we use
-static CFE_TBL_Handle_t dr_mode_def_handle;
-static dr_mode_def_entry_type * dr_mode_def_ptr;
-
-static CFE_TBL_Handle_t dr_d_matrix_handle;
-static dr_d_matrix_tbl_type * dr_d_matrix_ptr;
-
-static CFE_TBL_Handle_t dr_wtm_handle;
-static dr_wtm_entry_type * dr_wtm_ptr;
-
-static CFE_TBL_Handle_t DR_LC_WDTHandle;
-
-static CFE_TBL_Handle_t DR_LC_WRTHandle;
-
-
-///////////////////////////////////////////////////
-// Constants
-// Make the DR startup sync timeout the same as the SCH sync timeout. 
-static uint32 const DR_STARTUP_SYNC_TIMEOUT_MILLIS = 50000;
-static uint32 const DR_TABLE_WAIT_TIMEOUT_MILLIS = 10000;
-static uint32 const DR_TABLE_POLL_INTERVAL_MILLIS = 250;
-
-static char const * const DR_TEST_RESULTS_FILENAME = "/cf/dr_test_results.csv";
-static char const * const DR_FAILURE_MODES_FILENAME = "/cf/dr_failure_modes.csv";
-
-//////////////////////////////////////////////////
-// Private function prototypes
-static int32 DR_AppInit(void);
-static int32 DR_RegisterLcTables(void);
-static int32 DR_UnregisterLcTables(void);
-static int32 DR_InitTables(void);
-static int32 DR_InitSwBus(void);
-static int32 DR_ManageTables(void);
-static int32 DR_ChangeMode(int32 new_mode);
-static int32 DR_LoadLcWatchDefTable();
-static int32 DR_WaitForTable(CFE_TBL_Handle_t table_handle, uint32 timeout_millis);
-
-static int32   DR_AppPipe(CFE_SB_MsgPtr_t MessagePtr);
-static void    DR_ProcessGroundCommand(void);
-static void    DR_ReportHousekeeping(void);
-static void    DR_ResetCounters(void);
-static void    DR_ChangeModeCommand(void);
-static int32   DR_Wakeup(void);
-static int32   DR_Diagnose(void);
-static int32   DR_Shutdown(void);
-
-// TODO: Define table validation functions!! See cfe_tbl.h.
-// Follows form of int32 CallbackFunc(void *TblPtr);
-
-/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-/* DR_AppMain() -- Application entry point and main process loop          */
-/*                                                                            */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * *  * * * * **/
-
-//  cppcheck-suppress unusedFunction This is the app entry point, but cppcheck doesn't know that. (yet?)
-void DR_AppMain( void )
-{
-  int32  status;  
-  uint32 RunStatus = CFE_ES_APP_RUN;
-
-  CFE_ES_PerfLogEntry(DR_PERF_ID);
-  
-  status = DR_AppInit();
-  if (CFE_SUCCESS != status)
-  {
-    RunStatus = CFE_ES_APP_ERROR;
-  }
-
-  /*
-  ** DR Runloop
-  */
-
-#ifdef MODE_CHANGE_TRIGGER
-  // Hack in a counter to change mode after a while
-    int i = 0;
-#endif
-    
-  while (CFE_ES_RunLoop(&RunStatus))
-  {
-    CFE_ES_PerfLogExit(DR_PERF_ID);
-    
-    /* Pend on receipt of command packet -- timeout set to 500 millisecs */
-    status = CFE_SB_RcvMsg(&DR_MsgPtr, DR_CommandPipe, 500);
-    
-    CFE_ES_PerfLogEntry(DR_PERF_ID);
-    
-    if (CFE_SUCCESS == status)
-    {
-      status = DR_AppPipe(DR_MsgPtr);
-    }
-    if (CFE_SUCCESS != status)
-    {
-      switch(status)
-      {
-      case CFE_SUCCESS:
-      case CFE_SB_TIME_OUT:
-      case CFE_SB_NO_MESSAGE:
-	status = CFE_SUCCESS;
-	break;
-      case CFE_SB_BAD_ARGUMENT:
-      case CFE_SB_PIPE_RD_ERR:
-      default: // we got an unknown status
-	RunStatus = CFE_ES_APP_ERROR;
-	break;
-      }
-    }
-    
-  }
-  
-  // Check for "fatal" process error...
-  if (CFE_SUCCESS != status)
-  {
-    
-    // Send an event describing the reason for the termination
-    CFE_EVS_SendEvent(DR_TASK_EXIT_EID, CFE_EVS_CRITICAL,
-		      "Task terminating, err = 0x%08X", status);
-    
-    // In case cFE Event Services is not working
-    CFE_ES_WriteToSysLog("DR task terminating, err = 0x%08X\n", status);
-    
-  }
-  
-  DR_Shutdown();
-  
-  
-  CFE_ES_ExitApp(RunStatus);
-  
-} /* End of DR_AppMain() */
-
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  */
-/*                                                                            */
-/* DR_AppInit() --  initialization                                       */
-/*                                                                            */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
-int32 DR_AppInit(void) 
-{
-  ////////////////////////////////////////////////////////////////////////
-  // We will read the LC(X)-owned watchpoint result table. To ensure that
-  // we register for that table's handle after the LC(X) app has created it,
-  // we will call CFE_ES_WaitForStartupSync(). Note that if we have
-  // resources like tables of our own, we must create them before
-  // that call in case other apps are similarly waiting for our
-  // resources to be initialized.
-
-  //////////////////////////////////////////////////////////////////////
-  // Initialize "our stuff"
-
-  /*
-  ** Register the app with Executive services
-  */
-  int32 status = CFE_ES_RegisterApp();
-  
-  /*
-  ** Register the events
-  */
-  if(CFE_SUCCESS == status)
-  {
-    
-    status = CFE_EVS_Register(DR_EventFilters,
-			  sizeof(DR_EventFilters)/sizeof(CFE_EVS_BinFilter_t),
-			      CFE_EVS_BINARY_FILTER);
-    
-  }
-  
-  ///////////////////////////////////////////////////
-  // Initialize our software bus items
-  if(CFE_SUCCESS == status)
-  {
-    status = DR_InitSwBus();
-  }
-  
-  ///////////////////////////////////////////////////
-  // Initialize our tables
-  if(CFE_SUCCESS == status)
-  {
-    status = DR_InitTables();
-  }
-  
-  if(CFE_SUCCESS == status)
-  {
-    DR_ResetCounters();
-  }
-
-  //////////////////////////////////////////////////
-  // Initialize our data files
-  if(CFE_SUCCESS == status)
-  {
-    dr_error_type result = dr_open_results_files(
-      DR_TEST_RESULTS_FILENAME, DR_FAILURE_MODES_FILENAME);
-    
-    if(DR_ERROR_NO_ERROR != result)
-    {
-      status = DR_FILE_OPEN_ERROR;
-    }
-  }
-  
-  OS_printf("DR: After opening DR files, status = %ld\n", (long)status);
-  
-  //////////////////////////////////////////////////////////
-  // Now wait for other apps to initialize. No return value
-  // so we don't know if all apps initialized or if we timed out.
-  if (CFE_SUCCESS == status)
-  {
-    OS_printf("DR: Waiting for all apps to start\n");
-    CFE_ES_WaitForStartupSync(DR_STARTUP_SYNC_TIMEOUT_MILLIS);
-  }
-  
-  /////////////////////////////////////////////////////////
-  // Now register for "other apps' stuff"
-
-  // Register for the LC(X) watchpoint definition table and
-  // watchpoint results table
-  if (CFE_SUCCESS == status)
-  {
-    status = DR_RegisterLcTables();
-  }
-  OS_printf("DR: After DR_RegisterLcTables(), status = %ld\n", (long)status);
-
-  ///////////////////////////////////////////
-  // Now that all tables are registered, change to the default mode, 0 for now
-  if(CFE_SUCCESS == status)
-  {
-    status = DR_ChangeMode(0);
-  }
-
-  OS_printf("DR: After DR_ChangeMode, status = %ld\n", (long)status);
-  
-  if(CFE_SUCCESS == status)
-  {
-    CFE_SB_InitMsg(&DR_HkTelemetryPkt,
-                   DR_HK_TLM_MID,
-                   DR_HK_TLM_LNGTH, TRUE);
-    
-    CFE_EVS_SendEvent (DR_STARTUP_INF_EID, CFE_EVS_INFORMATION,
-		       "DR Initialized. Version %d.%d.%d.%d",
-		       DR_MAJOR_VERSION,
-		       DR_MINOR_VERSION, 
-		       DR_REVISION, 
-		       DR_MISSION_REV);
-  }
-  else
-  {
-    // send event that startup failed
-    CFE_EVS_SendEvent (DR_STARTUP_ERR_EID, CFE_EVS_ERROR,
-		       "DR: Error initializing app");
-  }
-
-  return status;
-  
-} /* End of DR_AppInit() */
-
-int32 DR_Shutdown(void)
-{  
-  // @TODO: Do we need to unregister the table(s), or is that handled
-  // by CFE_ES_ExitApp?
-
-  int32 status = DR_UnregisterLcTables();
-
-  // Close the files. Ignore any error since we are shutting down anyway.
-  dr_close_results_files();
-  
-  return status;
-}
-
-int32 DR_InitSwBus(void)
-{
-  int32 status = CFE_SUCCESS;
-  
-  /*
-  ** Create the Software Bus command pipe, subscribe to 
-  **  messages, and initialize the diagnosis message we send
-  */
-  if(CFE_SUCCESS == status)
-  {
-    status = CFE_SB_CreatePipe(&DR_CommandPipe, DR_PIPE_DEPTH,"DR_CMD_PIPE");
-  }
-  if(CFE_SUCCESS == status)
-  {
-    status = CFE_SB_Subscribe(DR_CMD_MID, DR_CommandPipe);
-  }
-  if(CFE_SUCCESS == status)
-  {
-    status = CFE_SB_Subscribe(DR_SEND_HK_MID, DR_CommandPipe);
-  }
-  if(CFE_SUCCESS == status)
-  {
-    status = CFE_SB_Subscribe(DR_WAKEUP_MID, DR_CommandPipe);
-  }
-
-  if(CFE_SUCCESS == status)
-  {
-    CFE_SB_InitMsg(&DR_Diagnosis_Msg, DR_DIAGNOSIS_MID,
-		   sizeof(dr_diagnosis_msg_type), TRUE);
-  }
-
-  return status;
-
-}
-
-int32 DR_InitTables(void)
-{
-  ///////////////////////////////////////////////////
-  // Start with the mode definition table as it contains
-  // the data we need for all of the others.
-  // Register, load, and get a pointer to the mode def table
-  uint32 option_flags = CFE_TBL_OPT_DEFAULT;
-  int32 status = CFE_TBL_Register(&dr_mode_def_handle, DR_MODE_DEF_NAME,
-		    (sizeof(dr_mode_def_entry_type)*DR_MAX_NUM_MODES),
-			    option_flags,
-			    NULL);
-
-  if(CFE_SUCCESS == status)
-  {
-    status = CFE_TBL_Load(dr_mode_def_handle,
-			  CFE_TBL_SRC_FILE, DR_MODE_DEF_DEFAULT_FILENAME);
-  }
-  
-  if(CFE_SUCCESS == status)
-  {
-    status = CFE_TBL_GetAddress((void *)&dr_mode_def_ptr, dr_mode_def_handle);
-    
-    if(CFE_TBL_INFO_UPDATED == status) 
-    {
-      status = CFE_SUCCESS;
-    }
-  }
-
-  ///////////////////////////////////////////////
-  // Register the other DR tables. They will be loaded and
-  // the addresses gotten at a later initilization step, by
-  // calling the mode change function. 
-  if(CFE_SUCCESS == status)
-  {
-    status = CFE_TBL_Register(&dr_d_matrix_handle, DR_D_MATRIX_NAME,
-			    sizeof(dr_d_matrix_tbl_type), option_flags,
-			    NULL);
-  }
-
-  if(CFE_SUCCESS == status)
-  {
-    status = CFE_TBL_Register(&dr_wtm_handle, DR_WTM_NAME,
-			      sizeof(dr_wtm_entry_type) * DR_MAX_TESTS,
-			      option_flags, NULL);
-  }
-  
-  return status;
-
-}
-
-int32 DR_RegisterLcTables(void)
-{
-
-  // Create the full name of the LCX Watchpoint Definition Table (WDT), which
-  // is APP_NAME.TABLE_NAME
-  char lcWdtTableName[CFE_TBL_MAX_FULL_NAME_LEN];
-  snprintf(lcWdtTableName, CFE_TBL_MAX_FULL_NAME_LEN, "%s.%s",
-	   LC_APP_NAME, LC_WDT_TABLENAME);
-
-  // Register for the table created by the other application
-  int32 status = CFE_TBL_Share( &DR_LC_WDTHandle, lcWdtTableName);
-  if(CFE_SUCCESS != status)
-  {
-      CFE_EVS_SendEvent(DR_TBL_SUB_ERR_EID, CFE_EVS_ERROR,
-			"Error initializing watchpoint definition table, "
-			"TblName=%s, RetCode=0x%08X", lcWdtTableName, status);
-  }
-
-  if(CFE_SUCCESS == status)
-  {
-    // Create the full name of the LCX Watchpoint Results Table (WRT), which is
-    // APP_NAME.TABLE_NAME
-    char lcWrtTableName[CFE_TBL_MAX_FULL_NAME_LEN];
-    snprintf(lcWrtTableName, CFE_TBL_MAX_FULL_NAME_LEN, "%s.%s",
-	     LC_APP_NAME, LC_WRT_TABLENAME);
-    
-    // Register for the table created by the other application
-    status = CFE_TBL_Share( &DR_LC_WRTHandle, lcWrtTableName);
-    if(CFE_SUCCESS != status)
-    {
-      CFE_EVS_SendEvent(DR_TBL_SUB_ERR_EID, CFE_EVS_ERROR,
-			"Error initializing watchpoint results table, "
-			"TblName=%s, RetCode=0x%08X", lcWrtTableName, status);
-    }
-  }
-
-  // @TODO: Setup this to be notified by a message when the LC.WRT is changed,
-  // instead of polling (I think - ask Pat?):
-  // CFE_TBL_NotifyByMessage in cfe_tbl.h
-
-
-  return status;
-
-}
-
-int32 DR_UnregisterLcTables(void)
-{
-  int32 status = CFE_TBL_Unregister(DR_LC_WDTHandle);
-
-  if(CFE_SUCCESS == status)
-  {
-    status = CFE_TBL_Unregister(DR_LC_WRTHandle);
-  }
-  
-  return status;
-}
-
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-/*                                                                 */
-/* Process a command pipe message                                  */
-/*                                                                 */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-int32 DR_AppPipe(CFE_SB_MsgPtr_t MessagePtr)
-{
-  int32           status      = CFE_SUCCESS;
-  CFE_SB_MsgId_t  MsgId;
-  
-  MsgId = CFE_SB_GetMsgId(DR_MsgPtr);
-  
-  switch (MsgId)
-  {
-  case DR_CMD_MID:
-    DR_ProcessGroundCommand();
-    break;
-    
-  case DR_SEND_HK_MID:
-    DR_ReportHousekeeping();
-    break;
-  case DR_WAKEUP_MID:
-    status = DR_Wakeup();
-    break;    
-  default:
-    DR_HkTelemetryPkt.dr_command_error_count++;
-    CFE_EVS_SendEvent(DR_COMMAND_ERR_EID,CFE_EVS_ERROR,
-		      "DR: invalid command packet,MID = 0x%x", MsgId);
-    break;
-  }
-  
-  return status;
-}
-
-
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
-/*                                                                            */
-/* DR_ProcessGroundCommand() -- DR ground commands                    */
-/*                                                                            */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
-
-void DR_ProcessGroundCommand(void)
-{
-    uint16 CommandCode;
-
-    CommandCode = CFE_SB_GetCmdCode(DR_MsgPtr);
-
-    /* Process "known" DR ground commands */
-    switch (CommandCode)
-    {
-        case DR_NOOP_CC:
-            DR_HkTelemetryPkt.dr_command_count++;
-            CFE_EVS_SendEvent(DR_COMMANDNOP_INF_EID,CFE_EVS_INFORMATION,
-			"DR: NOOP command");
-            break;
-
-        case DR_RESET_COUNTERS_CC:
-            DR_ResetCounters();
-            break;
-
-        case DR_CHANGE_MODE_CC:
-            DR_ChangeModeCommand();
-            break;
-
-        /* default case already found during FC vs length test */
-        default:
-            break;
-    }
-    return;
-
-} /* End of DR_ProcessGroundCommand() */
-
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
-/*  Name:  DR_ResetCounters                                               */
-/*                                                                            */
-/*  Purpose:                                                                  */
-/*         This function resets all the global counter variables that are     */
-/*         part of the task telemetry.                                        */
-/*                                                                            */
-/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
-void DR_ResetCounters(void)
-{
-    /* Status of commands processed by the DR */
-    DR_HkTelemetryPkt.dr_command_count       = 0;
-    DR_HkTelemetryPkt.dr_command_error_count = 0;
-
-    CFE_EVS_SendEvent(DR_COMMANDRST_INF_EID, CFE_EVS_INFORMATION,
-		"DR: RESET command");
-
-    return;
-
-} /* End of DR_ResetCounters() */
-
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
-/*  Name:  DR_ReportHousekeeping                                              */
-/*                                                                            */
-/*  Purpose:                                                                  */
-/*         This function is triggered in response to a task telemetry request */
-/*         from the housekeeping task. This function will gather the DR       */
-/*         telemetry, packetize it and send it to the housekeeping task via   */
-/*         the software bus                                                   */
-/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
-void DR_ReportHousekeeping(void)
-{
-    CFE_SB_TimeStampMsg((CFE_SB_Msg_t *) &DR_HkTelemetryPkt);
-    CFE_SB_SendMsg((CFE_SB_Msg_t *) &DR_HkTelemetryPkt);
-    return;
-
-} /* End of DR_ReportHousekeeping() */
-
-void    DR_ChangeModeCommand()
-{
-    int success = 1;
-    size_t ExpectLength = sizeof (dr_change_mode_cmd_type);
-    size_t ActualLength = CFE_SB_GetTotalMsgLength(DR_MsgPtr);
-    if (ActualLength != ExpectLength) {
-        CFE_EVS_SendEvent(DR_LEN_ERR_EID, CFE_EVS_ERROR,
-                          "DR Change Mode command with bad length (Expected %lu, Observed %lu)",
-                          (unsigned long)ExpectLength,
-                          (unsigned long)ActualLength);
-        success = 0;
-    }
-
-    dr_change_mode_cmd_type const *ptr =
-        (dr_change_mode_cmd_type *)DR_MsgPtr;
-
-    if (success) {
-        unsigned long new_mode = ptr->NewMode;
-        int32 status = DR_ChangeMode(new_mode);
-        if (CFE_SUCCESS != status) {
-            CFE_EVS_SendEvent(DR_COMMAND_ERR_EID, CFE_EVS_ERROR,
-                              "Unable to change to mode %lu, error code is 0x%08lX (%ld)",
-                              (unsigned long)new_mode,
-                              0xFFFFFFFF & (unsigned long)status, (long)status);
-            success = 0;
-        } else {
-            CFE_EVS_SendEvent(DR_MODE_CHANGED_INFO_EID, CFE_EVS_INFORMATION,
-                              "Switched to mode %lu",
-                              (unsigned long)new_mode);
-        }
-    }
-
-    if (success) {
-        DR_HkTelemetryPkt.dr_command_count++;
-    } else {
-        DR_HkTelemetryPkt.dr_command_error_count++;
-    }
-
-    return;
-} /* End of DR_ChangeModeCommand() */
-
-
-int32 DR_Wakeup(void)
-{
-
-  // First manage our tables on every wakeup.
-  int32 status = DR_ManageTables();
-  
-  // Now do a diagnosis
-  if(CFE_SUCCESS == status)
-  {
-    status = DR_Diagnose();
-  }
-  
-  return status;
-
-}
-
-int32 DR_Diagnose(void)
-{
-#ifdef DR_TIMING
-  struct timespec before_process_tests;
-  clock_gettime(/*CLOCK_REALTIME*/ CLOCK_THREAD_CPUTIME_ID, &before_process_tests); 
-#endif
-
-  ///////////////////////////////////////
-  // Process the test results
-  dr_test_result_type test_results[DR_MAX_TESTS];
-  uint32_t num_tests = dr_d_matrix_ptr->num_tests;
-  
-  int32 status = dr_process_tests(DR_LC_WRTHandle, dr_wtm_ptr,
-			    num_tests,
-			    test_results);
-
-#ifdef DR_TIMING
-  struct timespec before_process_d_matrix;
-  clock_gettime(/*CLOCK_REALTIME*/ CLOCK_THREAD_CPUTIME_ID, &before_process_d_matrix); 
-#endif
-
-  ///////////////////////////////////////
-  // Perform the diagnosis
-  DR_Diagnosis_Msg.num_failure_modes = dr_d_matrix_ptr->num_failure_modes;
-  
-  DR_Diagnosis_Msg.error = dr_process_d_matrix(
-    dr_d_matrix_ptr, num_tests, test_results,
-    DR_Diagnosis_Msg.num_failure_modes,
-    DR_Diagnosis_Msg.failure_modes);
-  
-  if(DR_Diagnosis_Msg.error != DR_ERROR_NO_ERROR)
-  {
-    status = DR_DIAGNOSIS_ERROR;
-  }
-
-#ifdef DR_TRACE_DR_TRACE_SUSPECTS_BADS
-  OS_printf("dr: suspect and bad failure modes:\n");
-  for(size_t i = 0; i < DR_Diagnosis_Msg.num_failure_modes; ++i)
-  {
-    if( (DR_FAILURE_MODE_SUSPECT == DR_Diagnosis_Msg.failure_modes[i]) ||
-	(DR_FAILURE_MODE_BAD == DR_Diagnosis_Msg.failure_modes[i]) )
-      {
-	OS_printf("   index %u = %u\n", i, DR_Diagnosis_Msg.failure_modes[i]);
-      }
-
-  }
-#endif
-  
-#ifdef DR_TIMING
-
-  struct timespec after_process_d_matrix;
-  clock_gettime(/*CLOCK_REALTIME*/CLOCK_THREAD_CPUTIME_ID, &after_process_d_matrix);
-
-  struct timespec test_results_time = time_interval(before_process_tests,
-						    before_process_d_matrix);
-  
-  struct timespec d_matrix_time = time_interval(before_process_d_matrix,
-						after_process_d_matrix);
-  
-  struct timespec total_diag_time = time_interval(before_process_tests,
-						  after_process_d_matrix);
-
-  OS_printf("DR: test_results_time: %11lld.%.9ld \n",
-	    (long long)test_results_time.tv_sec, test_results_time.tv_nsec);
-  OS_printf("DR: d_matrix_time: %11lld.%.9ld \n",
-	    (long long)d_matrix_time.tv_sec, d_matrix_time.tv_nsec);
-  OS_printf("DR: total_diag_time: %11lld.%.9ld \n",
-	    (long long)total_diag_time.tv_sec, total_diag_time.tv_nsec);
-    
-#endif
-
-  // Send the results to the software bus. This is a best-effort send
-  // like all sw bus messages and if it fails it would be logged
-  // by cFE. 
-  CFE_SB_TimeStampMsg((CFE_SB_Msg_t *) &DR_Diagnosis_Msg);
-  CFE_SB_SendMsg((CFE_SB_Msg_t *) &DR_Diagnosis_Msg);
-  
-  
-  // Write the results to the files
-  static int iteration = 0;
-  dr_error_type save_error = dr_save_results(
-    iteration,
-    DR_Diagnosis_Msg.error,
-    num_tests,
-    test_results,
-    DR_Diagnosis_Msg.num_failure_modes,
-    DR_Diagnosis_Msg.failure_modes);
-  iteration++; 
-  
-  if(save_error != DR_ERROR_NO_ERROR)
-  {
-    status = DR_RESULTS_SAVE_ERROR;
-  }
-
-#ifdef DR_TRACE
-  dr_print_results(DR_Diagnosis_Msg.error, dr_d_matrix_ptr,
-		   num_tests, test_results,
-		   DR_Diagnosis_Msg.num_failure_modes,
-		   DR_Diagnosis_Msg.failure_modes);
-#endif // DR_TRACE
-  
-  return status;
-}
-
-int32 DR_ManageTables(void)
-{
-    
-  // Must release loadable table pointers before allowing updates
-#ifdef DR_TRACE
-  OS_printf("DR: DR_ManageTables(): Releasing table addresses\n");
-#endif
-  CFE_TBL_ReleaseAddress(dr_mode_def_handle);
-  CFE_TBL_ReleaseAddress(dr_d_matrix_handle);
-  CFE_TBL_ReleaseAddress(dr_wtm_handle);
-  
-  // Manage the tables (I need to find out what is involved here)
-#ifdef DR_TRACE
-  OS_printf("DR: DR_ManageTables(): Managing the tables\n");
-#endif
-  CFE_TBL_Manage(dr_mode_def_handle);
-  CFE_TBL_Manage(dr_d_matrix_handle);
-  CFE_TBL_Manage(dr_wtm_handle);
-  
-  // Re-acquire the pointers 
-#ifdef DR_TRACE
-  OS_printf("DR: DR_ManageTables(): Re-acquiring the addresses\n");
-#endif
-  int32 status = CFE_TBL_GetAddress((void *)&dr_mode_def_ptr,
-			      dr_mode_def_handle);
-  if(CFE_TBL_INFO_UPDATED == status)
-  {
-    status = CFE_SUCCESS;
-  }
-  if(CFE_SUCCESS != status)
-  {
-    OS_printf("DR: DR_ManageTables(): Error getting address for mode def table:"
-		"status = 0x%08X\n", status);
-  }
-  
-  if (CFE_SUCCESS == status)
-  {
-    status = CFE_TBL_GetAddress((void *)&dr_d_matrix_ptr,
-				dr_d_matrix_handle);
-    if(CFE_TBL_INFO_UPDATED == status)
-    {
-      status = CFE_SUCCESS;
-    }
-    if(CFE_SUCCESS != status)
-    {
-      OS_printf("DR: DR_ManageTables(): Error getting address for d matrix table: "
-		"status = 0x%08X\n", status);
-    }
-  }
-  
-  if (CFE_SUCCESS == status)
-  {
-    status = CFE_TBL_GetAddress((void *)&dr_wtm_ptr,
-				dr_wtm_handle);
-    if(CFE_TBL_INFO_UPDATED == status)
-    {
-      status = CFE_SUCCESS;
-    }
-    if(CFE_SUCCESS != status)
-    {
-      OS_printf("DR: DR_ManageTables(): Error getting address for wtm table:"
-		"status = 0x%08X\n", status);
-    }
-  }
-  
-  return status;
-  
-}
-
-int32 DR_ChangeMode(int32 new_mode)
-{
-  // For DR, changing mode basically means loading new tables to use
-  // for diagnosis. This functionality was developed but is not in
-  // use yet. The intent is that DR will change modes based on receiving
-  // an external command. It would also be possible for DR to change
-  // modes based on sensor values or even additional LC watchpoint results.
-  // Exactly which to implement is a topic for future development. 
-  
-  int32 status = CFE_SUCCESS;
-
-  char * d_matrix_table_file = "";
-  char * wtm_table_file = "";
-  char * lc_wdt_table_file = "";
-  
-  if(CFE_SUCCESS == status)
-  {
-    // Read the mode definition table to find what files contain
-    // the tables we will load, and load them
-    int i;
-    for(i = 0; i < DR_MAX_NUM_MODES; ++i)
-      if(dr_mode_def_ptr[i].mode_index == new_mode)
-	break;
-
-    if (i < DR_MAX_NUM_MODES)
-    {
-      d_matrix_table_file = dr_mode_def_ptr[i].d_matrix_tbl_filename;
-      wtm_table_file = dr_mode_def_ptr[i].wtm_tbl_filename;  
-      lc_wdt_table_file = dr_mode_def_ptr[i].lc_wdt_tbl_filename;
-      if ((!d_matrix_table_file) || (!*d_matrix_table_file) ||
-          (!wtm_table_file) || (!*wtm_table_file) ||
-          (!lc_wdt_table_file) || (!*lc_wdt_table_file)) {
-        OS_printf("DR: mode %ld (table entry %d) is not valid.\n", (long)new_mode, i);
-        status = CFE_SEVERITY_ERROR;
-      }
-    } else {
-      OS_printf("DR: mode %ld is not valid (not in the table).\n", (long)new_mode);
-      status = CFE_SEVERITY_ERROR;
-    }
-  }
-
-  // If the request was invalid, avoid doing anything
-  // to change state.
-  if(CFE_SUCCESS == status)
-  {
-    // Must release loadable table pointers before making updates
-    OS_printf("DR: DR_ChangeMode(): Releasing table addresses\n");
-    CFE_TBL_ReleaseAddress(dr_d_matrix_handle);
-    CFE_TBL_ReleaseAddress(dr_wtm_handle);
-    CFE_TBL_ReleaseAddress(DR_LC_WDTHandle);
-    OS_printf("DR: DR_ChangeMode(): Before loading the tables, status = 0x%08X\n", status);
-  }
-
-  // Load the two tables that DR manages directly
-  if(CFE_SUCCESS == status)
-  {
-    status = CFE_TBL_Load(dr_d_matrix_handle,
-			  CFE_TBL_SRC_FILE, d_matrix_table_file);
-  }
-  
-  if(CFE_SUCCESS == status)
-  {
-    status = CFE_TBL_Load(dr_wtm_handle,
-			  CFE_TBL_SRC_FILE, wtm_table_file);
-  }
-
-  // Load the LC watchpoint definition table. Note this one takes
-  // quite a while, several seconds. (other tasks can run though.)
-  if(CFE_SUCCESS == status)
-  {
-    status = DR_LoadLcWatchDefTable(lc_wdt_table_file);
-  }
-
-  // If the tables loaded successfully, then manage them. I'm not
-  // sure what is involved with "managing" them on the cFS side but
-  // it looks necessary.
-  if(CFE_SUCCESS == status)
-  {
-    OS_printf("DR: DR_ChangeMode(): About to manage the tables.\n");
-    status = DR_ManageTables();
-  }
-  
-  return status;
-  
-}
-
-int32 DR_LoadLcWatchDefTable(char const * const lc_wdt_table_file)
-{
-
-  // Send SB commands to TBL task, to load a new LC table. There are 3
-  // commands to send to load that table:
-  //  - load the table into an inactive buffer
-  //  - verify the table
-  //  - activate the table
-  // Historical note: When I called the CFE_TBL_Load() directly, I got an error
-  // because LC still had the table locked (i.e., still held the address).
-  // This way had no errors, but there are complications. As I understand
-  // it, the TBL task signals the LC task to do the validation and activiation,
-  // so these functions are basically asynchronous. However, cFS gives
-  // an error if we attempt to activate the table before LC has finished
-  // the validation. So I implemented a function which polls to see when
-  // the operations have completed. This typically takes 2 sec or so. But,
-  // DR will not be performing diagnosis while this is in progress.
-  // Final way, I also found the TBL command handler functions and tried
-  // calling them directly in the hopes they would be synchronous that
-  // way. (CFE_TBL_LoadCmd(), CFE_TBL_ValidateCmd(), CFE_TBL_ActivateCmd() )
-  // It didn't work, it still waited for the LC task to do the
-  // table validation and activation. I left the software bus messages
-  // in place as the mechanism because that seemed better than calling
-  // the TBL task functions directly.
-  
-  int32 status = CFE_SUCCESS;
-  char * lc_wdt_table_name = LC_APP_NAME"."LC_WDT_TABLENAME;
-
-  if(CFE_SUCCESS == status)
-  {
-    // Send a software bus command to table services to load the new LC table  
-    CFE_TBL_LoadCmd_t table_load_cmd;
-    
-    CFE_SB_InitMsg(&table_load_cmd, CFE_TBL_CMD_MID,
-                   sizeof(CFE_TBL_LoadCmd_t), FALSE);
-    
-    CFE_SB_SetCmdCode( (CFE_SB_Msg_t *)(&table_load_cmd), CFE_TBL_LOAD_CC);
-    strncpy(table_load_cmd.Payload.LoadFilename, lc_wdt_table_file,
-	    OS_MAX_PATH_LEN);
-    
-    CFE_SB_SendMsg((CFE_SB_Msg_t *) &table_load_cmd);
-
-    status = DR_WaitForTable(DR_LC_WDTHandle, DR_TABLE_WAIT_TIMEOUT_MILLIS);
-    
-  }
-    
-  if(CFE_SUCCESS == status)
-  {
-    // Send a software bus command to table services to validate the new LC table  
-    CFE_TBL_ValidateCmd_t  table_validate_cmd;
-    
-    CFE_SB_InitMsg(&table_validate_cmd, CFE_TBL_CMD_MID,
-                   sizeof(CFE_TBL_ValidateCmd_t), FALSE);
-    
-    CFE_SB_SetCmdCode( (CFE_SB_Msg_t *)(&table_validate_cmd), CFE_TBL_VALIDATE_CC);
-    table_validate_cmd.Payload.ActiveTblFlag = CFE_TBL_INACTIVE_BUFFER;
-    strncpy(table_validate_cmd.Payload.TableName, lc_wdt_table_name, CFE_TBL_MAX_FULL_NAME_LEN);
-    
-    CFE_SB_SendMsg((CFE_SB_Msg_t *) &table_validate_cmd);
-    
-    OS_printf("DR: DR_ChangeMode(): Waiting on LC table validation...\n");
-    status = DR_WaitForTable(DR_LC_WDTHandle, DR_TABLE_WAIT_TIMEOUT_MILLIS);
-    
-  }
-  
-  if(CFE_SUCCESS == status)
-  {
-    // Send a software bus command to table services to activate the LC table
-    CFE_TBL_ActivateCmd_t  table_activate_cmd;
-    
-    CFE_SB_InitMsg(&table_activate_cmd, CFE_TBL_CMD_MID,
-                   sizeof(CFE_TBL_ActivateCmd_t), FALSE);
-    
-    CFE_SB_SetCmdCode( (CFE_SB_Msg_t *)(&table_activate_cmd), CFE_TBL_ACTIVATE_CC);
-    strncpy(table_activate_cmd.Payload.TableName, lc_wdt_table_name, CFE_TBL_MAX_FULL_NAME_LEN);
-    
-    CFE_SB_SendMsg((CFE_SB_Msg_t *) &table_activate_cmd);
-    
-    OS_printf("DR: DR_ChangeMode(): Waiting on LC table activation...\n");
-    status = DR_WaitForTable(DR_LC_WDTHandle, DR_TABLE_WAIT_TIMEOUT_MILLIS);
-
-  }
-  
-  // Check that it actually was the table that we wanted.
-  // It would be nice to have feedback before this point but I'm not
-  // sure how to do that. We will compare the filename to see if it
-  // matches what we tried to load. 
-  if(CFE_SUCCESS == status)
-  {
-    CFE_TBL_Info_t lc_wdt_info;
-    status = CFE_TBL_GetInfo(&lc_wdt_info, lc_wdt_table_name);
-    
-  
-    if(CFE_SUCCESS == status)
-    {
-      int val = strncmp(lc_wdt_table_file, lc_wdt_info.LastFileLoaded, OS_MAX_PATH_LEN);
-      if(0 == val)
-      {
-	OS_printf("DR: DR_ChangeMode(): LC WDT table ready to go!\n");
-      }
-      else
-      {
-	status = DR_WATCHPOINT_TABLE_LOAD_ERROR;
-      }
-    }
-  }
-
-  return status;
-
-}
-
-
-int32 DR_WaitForTable(CFE_TBL_Handle_t table_handle, uint32 timeout_millis)
-{
-  // This is not a precise timing, but it doesn't need to be. These delays
-  // are on the order of a couple of seconds. 
-  int32 loop_time_millis = 0;
-  int32 table_status = CFE_SUCCESS;
-
-  // Poll for the table status to be CFE_SUCCESS, indicating the
-  // action with the table is complete. Use do-while so that we
-  // will delay first, before checking the table status, to give
-  // the table task time to respond. Otherwise we were returning
-  // immediately before the table action was even started.
-  do
-  {
-    OS_TaskDelay(DR_TABLE_POLL_INTERVAL_MILLIS);
-    loop_time_millis += DR_TABLE_POLL_INTERVAL_MILLIS;
-    
-    table_status = CFE_TBL_GetStatus(table_handle);
-    
-    if(CFE_SUCCESS == table_status)
-    {
-      break;
-    }    
-    
-  }
-  while(loop_time_millis <= timeout_millis);
-
-  return table_status;
-  
-}
-
-//Function copied from internet at https://www.guyrutenberg.com/2007/09/22/profiling-code-using-clock_gettime/
-// but I changed the name a bit
-#ifdef DR_TIMING
-struct timespec time_interval(struct timespec start, struct timespec end)
-{
-  struct timespec temp;
-  if (end.tv_nsec < start.tv_nsec)
-  {
-    temp.tv_sec = end.tv_sec-start.tv_sec-1;
-    temp.tv_nsec = 1000000000+end.tv_nsec-start.tv_nsec;
-  }
-  else
-  {
-    temp.tv_sec = end.tv_sec-start.tv_sec;
-    temp.tv_nsec = end.tv_nsec-start.tv_nsec;
-  }
-  return temp;
-}
-#endif
+/*******************************************************************************
+** File: dr_app.c
+**
+** Purpose:
+**   This file contains the source code for the Diagnostic Reasoner.
+**
+*******************************************************************************/
+
+/*
+**   Include Files:
+*/
+
+#include "dr_app.h"
+#include "dr_perfids.h"
+#include "dr_msgids.h"
+#include "dr_platform_cfg.h"
+
+#include "lc_platform_cfg.h" // for LC_APP_NAME
+#include "lc_app.h" // for LC_WRT_TABLENAME
+#include "lc_msgids.h" // for LC_SAMPLE_AP_MID
+
+#include "cfe_tbl_msg.h"
+#include "cfe_tbl_filedef.h" // for CFE_TBL_File_Hdr_t
+#include "cfe_psp.h" // for CFE_PSP_GetTime()
+
+#include "dr_msg.h"
+#include "dr_events.h"
+#include "dr_version.h" 
+#include "dr_mode_def.h"
+#include "dr_d_matrix_tbl.h"
+#include "dr_wtm_tbl.h"
+
+#include "dr_process_tests.h"
+#include "dr_model.h"
+#include "dr_bitset_d_matrix.h"
+#include "dr_incremental_d_matrix.h"
+#include "dr_sparse_d_matrix.h"
+#include "dr_component_d_matrix.h"
+#include "dr_print_results.h"
+#include "dr_save_results.h"
+#include "dr_stats.h"
+
+////////////////////////////////////////////////////////
+// Stuff to help debugging/testing
+
+// Uncomment to enable trace messages
+//#define DR_TRACE
+// Hack, here are some other trace messages
+//#define DR_TRACE_SUSPECTS_BADS
+
+/*********************************
+** global data, what isn't shared with other modules is declared static
+*/
+static dr_hk_tlm_type         DR_HkTelemetryPkt;
+static dr_diagnosis_msg_type  DR_Diagnosis_Msg;
+static dr_perf_tlm_type       DR_PerfTelemetryPkt;
+static CFE_SB_PipeId_t        DR_CommandPipe;
+static CFE_SB_MsgPtr_t        DR_MsgPtr;
+
+
+static CFE_EVS_BinFilter_t  DR_EventFilters[] =
+       {  /* Event ID    mask */
+          {DR_STARTUP_INF_EID,       0x0000},
+          {DR_COMMAND_ERR_EID,       0x0000},
+          {DR_COMMANDNOP_INF_EID,    0x0000},
+          {DR_COMMANDRST_INF_EID,    0x0000},
+       };
+
+///////////////////////////////////////////
+// Handles to the various tables and table pointers we use
+static CFE_TBL_Handle_t dr_mode_def_handle;
+static dr_mode_def_entry_type * dr_mode_def_ptr;
+
+static CFE_TBL_Handle_t dr_d_matrix_handle;
+static dr_d_matrix_packed_tbl_type * dr_d_matrix_ptr;
+
+static CFE_TBL_Handle_t dr_wtm_handle;
+static dr_wtm_entry_type * dr_wtm_ptr;
+
+// True while the addresses of the DR tables above are held and up to
+// date, so managing the tables can be skipped until one of them has an
+// update, validation or dump pending.
+static bool dr_table_addresses_held = false;
+
+// The d-matrix and wtm tables compiled into a model for diagnosis.
+// Rebuilt only when either table is updated, so a diagnosis never reads
+// the tables themselves. There are two, and the tables are always
+// compiled into the one not in use, so a mode change can load and
+// compile the new mode's tables while the old mode's model goes on
+// diagnosing. Their storage comes from the DR memory pool. Until a good
+// pair of tables is compiled the model holds an error, which every
+// diagnosis reports.
+static dr_model_type dr_table_models[2];
+
+// The model compiled from what the DR tables hold now
+static dr_model_type * dr_model = &dr_table_models[0];
+
+// The model of a mode compiled into the model cache at startup, and the
+// tables it was compiled from, with their CRCs.
+typedef struct
+{
+  char d_matrix_tbl_filename[DR_MAX_MODE_TBL_FILENAME_LENGTH];
+  char wtm_tbl_filename[DR_MAX_MODE_TBL_FILENAME_LENGTH];
+  uint32 d_matrix_crc;
+  uint32 wtm_crc;
+  dr_model_type model;
+} dr_cached_model_type;
+
+// The model cache, filled at startup when DR_MODEL_CACHE_SIZE isn't 0.
+static dr_cached_model_type dr_model_cache[DR_MAX_NUM_MODES];
+static uint32 dr_model_cache_count = 0;
+
+// The model every diagnosis uses: one of the table models, or a cached
+// model after a change to a cached mode, until the tables are loaded
+// again.
+static dr_model_type const * dr_active_model = &dr_table_models[0];
+
+// True when the model or mode has changed since the last header of the
+// binary diagnosis log, so the next diagnosis starts a new segment.
+static bool dr_log_header_stale = true;
+
+// The previous component diagnosis, so the component engine only
+// solves the components whose tests changed.
+static dr_component_state_type dr_component_state;
+
+// The engine used for diagnosis, from the mode definition table entry
+// of the current mode.
+static dr_engine_type dr_diagnosis_engine = DR_ENGINE_INCREMENTAL;
+
+// The previous diagnosis, kept so the incremental engine only has to
+// revisit what changed. Reset whenever the model is recompiled.
+static dr_incremental_state_type dr_incremental_state;
+
+// True while DR_Diagnosis_Msg holds the diagnosis of the current model
+// and engine for dr_prev_test_results, so a wakeup with the same test
+// results can send it again without solving.
+static bool dr_diagnosis_current = false;
+
+// The errors of the last diagnosis and of saving it, so only a new
+// error is reported by an event, not every diagnosis that repeats it.
+static dr_error_type dr_last_diagnosis_error = DR_ERROR_NO_ERROR;
+static dr_error_type dr_last_save_error = DR_ERROR_NO_ERROR;
+
+// The wakeups since the last diagnosis, for the wakeup watchdog when
+// diagnosing on LC actionpoint samples.
+static uint32 dr_wakeups_since_diagnosis = 0;
+
+// The mode being diagnosed, and the mode change in progress, which
+// DR_AdvanceModeChange() carries on from the runloop: its step, the
+// mode definition entry of the new mode, the model compiled for it,
+// when the change and the step started, when in the step to poll the
+// LC WDT next and the interval after that, and the outcome of the last
+// mode change.
+static int32 dr_mode = 0;
+static dr_mode_change_state_type dr_mode_change_state = DR_MODE_CHANGE_IDLE;
+static dr_mode_def_entry_type dr_mode_change_def;
+static dr_model_type const * dr_mode_change_model;
+static uint32 dr_mode_change_start_usec;
+static uint32 dr_mode_change_step_usec;
+static uint32 dr_mode_change_poll_millis;
+static uint32 dr_mode_change_poll_interval_millis;
+static int32 dr_mode_change_status = CFE_SUCCESS;
+
+// The time each step of the last mode change took, as reported in the
+// housekeeping telemetry.
+static uint32 dr_mode_change_step_times[DR_MODE_CHANGE_STATE_COUNT];
+
+// The LC WDT file of the mode being diagnosed, and true while LC may
+// have another WDT active, as after a mode change failed once LC was
+// asked to activate the new mode's. LC's watchpoint results mean
+// something else to the model then, so DR doesn't diagnose until LC has
+// the mode's WDT again or a mode change succeeds.
+static char dr_mode_lc_wdt_tbl_filename[DR_MAX_MODE_TBL_FILENAME_LENGTH];
+static bool dr_lc_wdt_mismatch = false;
+
+// The LC WDT's update time before its activation was asked for
+static uint32 dr_lc_wdt_update_seconds;
+static uint32 dr_lc_wdt_update_subseconds;
+
+static CFE_TBL_Handle_t DR_LC_WDTHandle;
+
+static CFE_TBL_Handle_t DR_LC_WRTHandle;
+
+///////////////////////////////////////////
+// The DR memory pool, and the buffers allocated from it, which are sized
+// for the largest model. The model actually loaded uses only the part
+// given by the d-matrix table header.
+static uint32 DR_MemPool[DR_MEM_POOL_SIZE / sizeof(uint32)];
+static CFE_ES_MemHandle_t DR_MemPoolHandle;
+
+#if DR_MODEL_CACHE_SIZE > 0
+// The pool the cached models' storage is allocated from. Unlike the
+// DR memory pool, each model takes only what its own size needs.
+static uint32 DR_ModelCachePool[DR_MODEL_CACHE_SIZE / sizeof(uint32)];
+static CFE_ES_MemHandle_t DR_ModelCachePoolHandle;
+#endif
+
+// The test results of this and the previous diagnosis, the latter used
+// for the latching tests.
+static dr_test_result_type * dr_test_results;
+static dr_test_result_type * dr_prev_test_results;
+
+
+///////////////////////////////////////////////////
+// Constants
+// Make the DR startup sync timeout the same as the SCH sync timeout. 
+static uint32 const DR_STARTUP_SYNC_TIMEOUT_MILLIS = 50000;
+static uint32 const DR_TABLE_WAIT_TIMEOUT_MILLIS = 10000;
+static uint32 const DR_TABLE_POLL_INTERVAL_MILLIS = 250;
+static uint32 const DR_TABLE_FIRST_POLL_MILLIS = 10;
+
+static char const * const DR_TEST_RESULTS_FILENAME = "/cf/dr_test_results.csv";
+static char const * const DR_FAILURE_MODES_FILENAME = "/cf/dr_failure_modes.csv";
+static char const * const DR_RESULTS_LOG_FILENAME = "/cf/dr_results.log";
+
+// The buffer table files are read into a piece at a time, to check
+// their CRC against the tables'.
+static uint8 DR_TableFileChunk[4096];
+
+//////////////////////////////////////////////////
+// Private function prototypes
+static int32 DR_AppInit(void);
+static int32 DR_RegisterLcTables(void);
+static int32 DR_UnregisterLcTables(void);
+static int32 DR_InitTables(void);
+static int32 DR_InitModelMemory(void);
+static int32 DR_AllocateModelStorage(CFE_ES_MemHandle_t pool_handle,
+				     dr_model_storage_type * storage,
+				     uint32 max_tests, uint32 max_failure_modes,
+				     uint32 max_nonzeros);
+static int32 DR_AllocateModelBuffer(CFE_ES_MemHandle_t pool_handle,
+				    void ** buffer_ptr, uint32 size);
+#if DR_MODEL_CACHE_SIZE > 0
+static int32 DR_FillModelCache(void);
+static uint32 DR_TableCrc(char const * table_name);
+#endif
+static dr_model_type const * DR_FindCachedModel(dr_mode_def_entry_type const * entry);
+static void  DR_UseModel(dr_model_type const * model);
+static int32 DR_InitSwBus(void);
+static int32 DR_ManageTables(void);
+static int32 DR_RefreshTables(bool use_model);
+static bool  DR_TableActionPending(void);
+static bool  DR_DiagnosisBlocked(void);
+static int32 DR_ValidateModeDefTable(void * TblPtr);
+static int32 DR_ValidateDMatrixTable(void * TblPtr);
+static int32 DR_ValidateWtmTable(void * TblPtr);
+static bool  DR_EngineSupported(dr_engine_type engine);
+static bool  DR_ModelSupportsEngine(dr_model_type const * model,
+				    dr_engine_type engine);
+static int32 DR_ChangeMode(int32 new_mode);
+static int32 DR_StartModeChange(int32 new_mode);
+static void  DR_AdvanceModeChange(void);
+static int32 DR_ModeChangeWaitMillis(void);
+static void  DR_StartModeChangeStep(dr_mode_change_state_type step);
+static void  DR_ContinueModeChange(int32 status,
+				   dr_mode_change_state_type next_step);
+static void  DR_LoadLcWdt(void);
+static void  DR_ActivateLcWdt(void);
+static bool  DR_LcWdtUpdated(void);
+static void  DR_SendLcWdtCommand(uint16 command_code);
+static int32 DR_SwitchMode(void);
+static int32 DR_LoadModeModel(dr_mode_def_entry_type const * entry);
+#if DR_MODEL_CACHE_SIZE > 0
+static int32 DR_LoadModelTables(dr_mode_def_entry_type const * entry);
+#endif
+static int32 DR_LoadTableFile(CFE_TBL_Handle_t handle,
+			      char const * const table_name,
+			      char const * const table_file);
+static int32 DR_CompileModelTables(void);
+static int32 DR_CheckLcWdtFile(char const * lc_wdt_table_file);
+static bool  DR_TableHasFile(char const * table_name, char const * table_file);
+static int32 DR_TableFileCrc(char const * table_file, uint32 table_size,
+			     uint32 * crc);
+static uint32 DR_BigEndian32(void const * field);
+static void  DR_FinishModeChange(int32 status);
+
+static int32   DR_AppPipe(CFE_SB_MsgPtr_t MessagePtr);
+static void    DR_ProcessGroundCommand(void);
+static void    DR_ReportHousekeeping(void);
+static void    DR_ResetCounters(void);
+static void    DR_ChangeModeCommand(void);
+static void    DR_SendPerfCommand(void);
+static void    DR_ResetPerfCommand(void);
+static uint32  DR_GetTimeMicros(void);
+static void    DR_RecordStageTime(dr_stats_stage_type stage, uint32 start_usec);
+static int32   DR_Wakeup(void);
+static int32   DR_Diagnose(uint32 wakeup_usec);
+#if DR_RESULTS_LOG_FORMAT == DR_RESULTS_BINARY
+static dr_error_type DR_SaveResultsLogHeader(dr_model_type const * model);
+#endif
+static void    DR_SolveModel(dr_model_type const * model, uint32 num_tests,
+			     dr_test_result_type const * test_results);
+static int32   DR_Shutdown(void);
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* DR_AppMain() -- Application entry point and main process loop          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * *  * * * * **/
+
+//  cppcheck-suppress unusedFunction This is the app entry point, but cppcheck doesn't know that. (yet?)
+void DR_AppMain( void )
+{
+  int32  status;  
+  uint32 RunStatus = CFE_ES_APP_RUN;
+
+  CFE_ES_PerfLogEntry(DR_PERF_ID);
+  
+  status = DR_AppInit();
+  if (CFE_SUCCESS != status)
+  {
+    RunStatus = CFE_ES_APP_ERROR;
+  }
+
+  /*
+  ** DR Runloop
+  */
+
+#ifdef MODE_CHANGE_TRIGGER
+  // Hack in a counter to change mode after a while
+    int i = 0;
+#endif
+    
+  while (CFE_ES_RunLoop(&RunStatus))
+  {
+    CFE_ES_PerfLogExit(DR_PERF_ID);
+    
+    /* Pend on receipt of command packet -- timeout set to 500 millisecs,
+    ** or until the next table poll while a mode change is in progress */
+    status = CFE_SB_RcvMsg(&DR_MsgPtr, DR_CommandPipe,
+			   DR_ModeChangeWaitMillis());
+    
+    CFE_ES_PerfLogEntry(DR_PERF_ID);
+    
+    if (CFE_SUCCESS == status)
+    {
+      status = DR_AppPipe(DR_MsgPtr);
+    }
+
+    DR_AdvanceModeChange();
+    if (CFE_SUCCESS != status)
+    {
+      switch(status)
+      {
+      case CFE_SUCCESS:
+      case CFE_SB_TIME_OUT:
+      case CFE_SB_NO_MESSAGE:
+	status = CFE_SUCCESS;
+	break;
+      case DR_DIAGNOSIS_ERROR:
+      case DR_RESULTS_SAVE_ERROR:
+	// Already counted and reported by DR_Diagnose(), and the diagnosis
+	// was sent with its error. The next one may succeed, for instance
+	// once a table load makes the tables consistent again.
+	status = CFE_SUCCESS;
+	break;
+      case CFE_SB_BAD_ARGUMENT:
+      case CFE_SB_PIPE_RD_ERR:
+      default: // we got an unknown status
+	RunStatus = CFE_ES_APP_ERROR;
+	break;
+      }
+    }
+    
+  }
+  
+  // Check for "fatal" process error...
+  if (CFE_SUCCESS != status)
+  {
+    
+    // Send an event describing the reason for the termination
+    CFE_EVS_SendEvent(DR_TASK_EXIT_EID, CFE_EVS_CRITICAL,
+		      "Task terminating, err = 0x%08X", status);
+    
+    // In case cFE Event Services is not working
+    CFE_ES_WriteToSysLog("DR task terminating, err = 0x%08X\n", status);
+    
+  }
+  
+  DR_Shutdown();
+  
+  
+  CFE_ES_ExitApp(RunStatus);
+  
+} /* End of DR_AppMain() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  */
+/*                                                                            */
+/* DR_AppInit() --  initialization                                       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+int32 DR_AppInit(void) 
+{
+  ////////////////////////////////////////////////////////////////////////
+  // We will read the LC(X)-owned watchpoint result table. To ensure that
+  // we register for that table's handle after the LC(X) app has created it,
+  // we will call CFE_ES_WaitForStartupSync(). Note that if we have
+  // resources like tables of our own, we must create them before
+  // that call in case other apps are similarly waiting for our
+  // resources to be initialized.
+
+  //////////////////////////////////////////////////////////////////////
+  // Initialize "our stuff"
+
+  /*
+  ** Register the app with Executive services
+  */
+  int32 status = CFE_ES_RegisterApp();
+  
+  /*
+  ** Register the events
+  */
+  if(CFE_SUCCESS == status)
+  {
+    
+    status = CFE_EVS_Register(DR_EventFilters,
+			  sizeof(DR_EventFilters)/sizeof(CFE_EVS_BinFilter_t),
+			      CFE_EVS_BINARY_FILTER);
+    
+  }
+  
+  ///////////////////////////////////////////////////
+  // Initialize our software bus items
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_InitSwBus();
+  }
+  
+  ///////////////////////////////////////////////////
+  // Initialize our tables
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_InitTables();
+  }
+  
+  if(CFE_SUCCESS == status)
+  {
+    DR_ResetCounters();
+  }
+
+  //////////////////////////////////////////////////
+  // Initialize our data files
+  if(CFE_SUCCESS == status)
+  {
+#if DR_RESULTS_LOG_FORMAT == DR_RESULTS_BINARY
+    dr_error_type result = dr_open_results_log(DR_RESULTS_LOG_FILENAME);
+#else
+    dr_error_type result = dr_open_results_files(
+      DR_TEST_RESULTS_FILENAME, DR_FAILURE_MODES_FILENAME);
+#endif
+    
+    if(DR_ERROR_NO_ERROR != result)
+    {
+      status = DR_FILE_OPEN_ERROR;
+    }
+  }
+  
+  OS_printf("DR: After opening DR files, status = %ld\n", (long)status);
+  
+  //////////////////////////////////////////////////////////
+  // Now wait for other apps to initialize. No return value
+  // so we don't know if all apps initialized or if we timed out.
+  if (CFE_SUCCESS == status)
+  {
+    OS_printf("DR: Waiting for all apps to start\n");
+    CFE_ES_WaitForStartupSync(DR_STARTUP_SYNC_TIMEOUT_MILLIS);
+  }
+  
+  /////////////////////////////////////////////////////////
+  // Now register for "other apps' stuff"
+
+  // Register for the LC(X) watchpoint definition table and
+  // watchpoint results table
+  if (CFE_SUCCESS == status)
+  {
+    status = DR_RegisterLcTables();
+  }
+  OS_printf("DR: After DR_RegisterLcTables(), status = %ld\n", (long)status);
+
+#if DR_MODEL_CACHE_SIZE > 0
+  // Compile the models of the modes before the first mode change, so
+  // it can already use the cache.
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_FillModelCache();
+  }
+#endif
+
+  ///////////////////////////////////////////
+  // Now that all tables are registered, change to the default mode, 0 for now
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_ChangeMode(0);
+  }
+
+  OS_printf("DR: After DR_ChangeMode, status = %ld\n", (long)status);
+  
+  if(CFE_SUCCESS == status)
+  {
+    CFE_SB_InitMsg(&DR_HkTelemetryPkt,
+                   DR_HK_TLM_MID,
+                   DR_HK_TLM_LNGTH, TRUE);
+    
+    CFE_EVS_SendEvent (DR_STARTUP_INF_EID, CFE_EVS_INFORMATION,
+		       "DR Initialized. Version %d.%d.%d.%d",
+		       DR_MAJOR_VERSION,
+		       DR_MINOR_VERSION, 
+		       DR_REVISION, 
+		       DR_MISSION_REV);
+  }
+  else
+  {
+    // send event that startup failed
+    CFE_EVS_SendEvent (DR_STARTUP_ERR_EID, CFE_EVS_ERROR,
+		       "DR: Error initializing app");
+  }
+
+  return status;
+  
+} /* End of DR_AppInit() */
+
+int32 DR_Shutdown(void)
+{  
+  // @TODO: Do we need to unregister the table(s), or is that handled
+  // by CFE_ES_ExitApp?
+
+  int32 status = DR_UnregisterLcTables();
+
+  // Close the files. Ignore any error since we are shutting down anyway.
+#if DR_RESULTS_LOG_FORMAT == DR_RESULTS_BINARY
+  dr_close_results_log();
+#else
+  dr_close_results_files();
+#endif
+  
+  return status;
+}
+
+int32 DR_InitSwBus(void)
+{
+  int32 status = CFE_SUCCESS;
+  
+  /*
+  ** Create the Software Bus command pipe, subscribe to 
+  **  messages, and initialize the diagnosis message we send
+  */
+  if(CFE_SUCCESS == status)
+  {
+    status = CFE_SB_CreatePipe(&DR_CommandPipe, DR_PIPE_DEPTH,"DR_CMD_PIPE");
+  }
+  if(CFE_SUCCESS == status)
+  {
+    status = CFE_SB_Subscribe(DR_CMD_MID, DR_CommandPipe);
+  }
+  if(CFE_SUCCESS == status)
+  {
+    status = CFE_SB_Subscribe(DR_SEND_HK_MID, DR_CommandPipe);
+  }
+  if(CFE_SUCCESS == status)
+  {
+    status = CFE_SB_Subscribe(DR_WAKEUP_MID, DR_CommandPipe);
+  }
+#if DR_DIAGNOSE_ON_LC_SAMPLE
+  if(CFE_SUCCESS == status)
+  {
+    status = CFE_SB_Subscribe(LC_SAMPLE_AP_MID, DR_CommandPipe);
+  }
+#endif
+
+  if(CFE_SUCCESS == status)
+  {
+    CFE_SB_InitMsg(&DR_Diagnosis_Msg, DR_DIAGNOSIS_MID,
+		   sizeof(dr_diagnosis_msg_type), TRUE);
+    CFE_SB_InitMsg(&DR_PerfTelemetryPkt, DR_PERF_TLM_MID,
+		   DR_PERF_TLM_LNGTH, TRUE);
+    DR_PerfTelemetryPkt.num_stages = DR_STATS_STAGE_COUNT;
+  }
+
+  return status;
+
+}
+
+int32 DR_InitTables(void)
+{
+  ///////////////////////////////////////////////////
+  // Start with the mode definition table as it contains
+  // the data we need for all of the others.
+  // Register, load, and get a pointer to the mode def table
+  uint32 option_flags = CFE_TBL_OPT_DEFAULT;
+  int32 status = CFE_TBL_Register(&dr_mode_def_handle, DR_MODE_DEF_NAME,
+		    (sizeof(dr_mode_def_entry_type)*DR_MAX_NUM_MODES),
+			    option_flags,
+			    DR_ValidateModeDefTable);
+
+  if(CFE_SUCCESS == status)
+  {
+    status = CFE_TBL_Load(dr_mode_def_handle,
+			  CFE_TBL_SRC_FILE, DR_MODE_DEF_DEFAULT_FILENAME);
+  }
+  
+  if(CFE_SUCCESS == status)
+  {
+    status = CFE_TBL_GetAddress((void *)&dr_mode_def_ptr, dr_mode_def_handle);
+    
+    if(CFE_TBL_INFO_UPDATED == status) 
+    {
+      status = CFE_SUCCESS;
+    }
+  }
+
+  ///////////////////////////////////////////////
+  // Register the other DR tables. They will be loaded and
+  // the addresses gotten at a later initilization step, by
+  // calling the mode change function. Both are registered at the
+  // largest model size; the d-matrix header gives the actual size.
+  if(CFE_SUCCESS == status)
+  {
+    status = CFE_TBL_Register(&dr_d_matrix_handle, DR_D_MATRIX_NAME,
+			    sizeof(dr_d_matrix_packed_tbl_type), option_flags,
+			    DR_ValidateDMatrixTable);
+  }
+
+  if(CFE_SUCCESS == status)
+  {
+    status = CFE_TBL_Register(&dr_wtm_handle, DR_WTM_NAME,
+			      sizeof(dr_wtm_entry_type) * DR_MAX_MODEL_TESTS,
+			      option_flags, DR_ValidateWtmTable);
+  }
+
+  // Allocate the memory for the model now, so that loading a model
+  // never needs to.
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_InitModelMemory();
+  }
+  
+  return status;
+
+}
+
+int32 DR_InitModelMemory(void)
+{
+  dr_model_storage_type storage[2];
+
+  int32 status = CFE_ES_PoolCreate(&DR_MemPoolHandle, (uint8 *)DR_MemPool,
+				   sizeof(DR_MemPool));
+
+  for(uint32 i = 0; (i < 2) && (CFE_SUCCESS == status); ++i)
+  {
+    status = DR_AllocateModelStorage(DR_MemPoolHandle, &storage[i],
+				     DR_MAX_MODEL_TESTS,
+				     DR_MAX_MODEL_FAILURE_MODES,
+				     DR_MAX_MODEL_NONZEROS);
+  }
+
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_AllocateModelBuffer(DR_MemPoolHandle,
+      (void **)&dr_test_results,
+      sizeof(dr_test_result_type) * DR_MAX_MODEL_TESTS);
+  }
+
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_AllocateModelBuffer(DR_MemPoolHandle,
+      (void **)&dr_prev_test_results,
+      sizeof(dr_test_result_type) * DR_MAX_MODEL_TESTS);
+  }
+
+  if(CFE_SUCCESS == status)
+  {
+    dr_init_model(&dr_table_models[0], &storage[0]);
+    dr_init_model(&dr_table_models[1], &storage[1]);
+
+    for(uint32 i = 0; i < DR_MAX_MODEL_TESTS; ++i)
+    {
+      dr_prev_test_results[i] = DR_TEST_RESULT_UNKNOWN;
+    }
+  }
+  else
+  {
+    OS_printf("DR: DR_InitModelMemory(): Error allocating model memory: "
+	      "status = 0x%08X\n", status);
+  }
+
+  return status;
+}
+
+int32 DR_AllocateModelStorage(CFE_ES_MemHandle_t pool_handle,
+			      dr_model_storage_type * storage,
+			      uint32 max_tests, uint32 max_failure_modes,
+			      uint32 max_nonzeros)
+{
+  memset(storage, 0, sizeof(*storage));
+  storage->max_tests = max_tests;
+  storage->max_failure_modes = max_failure_modes;
+  storage->max_nonzeros = max_nonzeros;
+  storage->max_watchpoints = LC_MAX_WATCHPOINTS;
+
+  int32 status = DR_AllocateModelBuffer(pool_handle,
+      (void **)&storage->bitset_rows,
+      sizeof(dr_bitset_word_type) *
+      DR_BITSET_ROW_STORAGE_WORDS(max_tests, max_failure_modes));
+
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_AllocateModelBuffer(pool_handle,
+      (void **)&storage->bitset_cols,
+      sizeof(dr_bitset_word_type) *
+      DR_BITSET_COL_STORAGE_WORDS(max_tests, max_failure_modes));
+  }
+
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_AllocateModelBuffer(pool_handle,
+      (void **)&storage->sparse_row_starts,
+      sizeof(dr_sparse_offset_type) * (max_failure_modes + 1));
+  }
+
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_AllocateModelBuffer(pool_handle,
+      (void **)&storage->sparse_row_tests,
+      sizeof(dr_sparse_index_type) * max_nonzeros);
+  }
+
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_AllocateModelBuffer(pool_handle,
+      (void **)&storage->sparse_col_starts,
+      sizeof(dr_sparse_offset_type) * (max_tests + 1));
+  }
+
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_AllocateModelBuffer(pool_handle,
+      (void **)&storage->sparse_col_failure_modes,
+      sizeof(dr_sparse_index_type) * max_nonzeros);
+  }
+
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_AllocateModelBuffer(pool_handle,
+      (void **)&storage->components, sizeof(dr_components_type));
+  }
+
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_AllocateModelBuffer(pool_handle,
+      (void **)&storage->gather_watchpoints,
+      sizeof(uint32_t) * storage->max_watchpoints);
+  }
+
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_AllocateModelBuffer(pool_handle,
+      (void **)&storage->gather_tests,
+      sizeof(dr_gather_test_type) * max_tests);
+  }
+
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_AllocateModelBuffer(pool_handle,
+      (void **)&storage->gather_clear_slots,
+      sizeof(dr_gather_slot_type) * max_tests * DR_MAX_CLEAR_CONDS);
+  }
+
+  return status;
+}
+
+int32 DR_AllocateModelBuffer(CFE_ES_MemHandle_t pool_handle,
+			     void ** buffer_ptr, uint32 size)
+{
+  // The pool only aligns its blocks to 32 bits, so ask for enough
+  // extra to align the buffer to a cache line.
+  uint32 * block = NULL;
+  int32 status = CFE_ES_GetPoolBuf(&block, pool_handle,
+				   size + DR_MODEL_ALIGNMENT);
+
+  // CFE_ES_GetPoolBuf() returns the size of the block on success
+  if(status >= 0)
+  {
+    uintptr_t const address = (uintptr_t)block;
+    uintptr_t const align = DR_MODEL_ALIGNMENT;
+    *buffer_ptr = (void *)((address + align - 1) & ~(align - 1));
+    status = CFE_SUCCESS;
+  }
+
+  return status;
+}
+
+#if DR_MODEL_CACHE_SIZE > 0
+int32 DR_FillModelCache(void)
+{
+  // Load the tables of each mode, as a mode change would, which
+  // compiles them into a table model, then compile them again into storage
+  // of just that model's size in the cache. Modes that share their
+  // d-matrix and wtm tables share their cached model too. A mode whose
+  // tables don't make a good model isn't cached, so changing to it
+  // reports the error as before.
+  int32 status = CFE_ES_PoolCreate(&DR_ModelCachePoolHandle,
+				   (uint8 *)DR_ModelCachePool,
+				   sizeof(DR_ModelCachePool));
+  bool cache_full = false;
+
+  for(int i = 0; (i < DR_MAX_NUM_MODES) && (CFE_SUCCESS == status) &&
+	!cache_full; ++i)
+  {
+    dr_mode_def_entry_type const * const entry = &dr_mode_def_ptr[i];
+
+    if( (*entry->d_matrix_tbl_filename) && (*entry->wtm_tbl_filename) &&
+	(NULL == DR_FindCachedModel(entry)) &&
+	(CFE_SUCCESS == DR_LoadModelTables(entry)) &&
+	(DR_ERROR_NO_ERROR == dr_model->error) )
+    {
+      dr_cached_model_type * const cached = &dr_model_cache[dr_model_cache_count];
+      dr_model_storage_type storage;
+
+      // A d-matrix too big for the sparse engine gets no sparse storage,
+      // and keeps its error.
+      uint32 const num_nonzeros =
+	(DR_ERROR_NO_ERROR == dr_model->sparse_error) ?
+	dr_model->sparse.num_nonzeros : 0;
+
+      if(CFE_SUCCESS == DR_AllocateModelStorage(DR_ModelCachePoolHandle,
+						&storage,
+						dr_model->num_tests,
+						dr_model->num_failure_modes,
+						num_nonzeros))
+      {
+	dr_init_model(&cached->model, &storage);
+	dr_compile_model(&cached->model, dr_d_matrix_ptr, dr_wtm_ptr);
+	strncpy(cached->d_matrix_tbl_filename, entry->d_matrix_tbl_filename,
+		DR_MAX_MODE_TBL_FILENAME_LENGTH);
+	strncpy(cached->wtm_tbl_filename, entry->wtm_tbl_filename,
+		DR_MAX_MODE_TBL_FILENAME_LENGTH);
+	cached->d_matrix_crc = DR_TableCrc(DR_APP_NAME"."DR_D_MATRIX_NAME);
+	cached->wtm_crc = DR_TableCrc(DR_APP_NAME"."DR_WTM_NAME);
+	++dr_model_cache_count;
+	OS_printf("DR: DR_FillModelCache(): Cached the model of mode %ld\n",
+		  (long)entry->mode_index);
+      }
+      else
+      {
+	OS_printf("DR: DR_FillModelCache(): Cache full, mode %ld and later "
+		  "modes are not cached\n", (long)entry->mode_index);
+	cache_full = true;
+      }
+    }
+  }
+
+  if(CFE_SUCCESS != status)
+  {
+    OS_printf("DR: DR_FillModelCache(): Error creating the model cache: "
+	      "status = 0x%08X\n", status);
+  }
+
+  return status;
+}
+
+uint32 DR_TableCrc(char const * const table_name)
+{
+  CFE_TBL_Info_t table_info;
+  uint32 crc = 0;
+
+  if(CFE_SUCCESS == CFE_TBL_GetInfo(&table_info, table_name))
+  {
+    crc = table_info.Crc;
+  }
+
+  return crc;
+}
+#endif
+
+dr_model_type const * DR_FindCachedModel(dr_mode_def_entry_type const * entry)
+{
+  dr_model_type const * model = NULL;
+
+  for(uint32 i = 0; (i < dr_model_cache_count) && (NULL == model); ++i)
+  {
+    if( (0 == strncmp(dr_model_cache[i].d_matrix_tbl_filename,
+		      entry->d_matrix_tbl_filename,
+		      DR_MAX_MODE_TBL_FILENAME_LENGTH)) &&
+	(0 == strncmp(dr_model_cache[i].wtm_tbl_filename,
+		      entry->wtm_tbl_filename,
+		      DR_MAX_MODE_TBL_FILENAME_LENGTH)) )
+    {
+      model = &dr_model_cache[i].model;
+    }
+  }
+
+  return model;
+}
+
+void DR_UseModel(dr_model_type const * model)
+{
+  dr_active_model = model;
+
+  // The previous diagnosis was of the old model
+  dr_reset_incremental_d_matrix(&dr_incremental_state);
+  dr_reset_component_d_matrix(&dr_component_state);
+  dr_diagnosis_current = false;
+  dr_log_header_stale = true;
+}
+
+int32 DR_RegisterLcTables(void)
+{
+
+  // Create the full name of the LCX Watchpoint Definition Table (WDT), which
+  // is APP_NAME.TABLE_NAME
+  char lcWdtTableName[CFE_TBL_MAX_FULL_NAME_LEN];
+  snprintf(lcWdtTableName, CFE_TBL_MAX_FULL_NAME_LEN, "%s.%s",
+	   LC_APP_NAME, LC_WDT_TABLENAME);
+
+  // Register for the table created by the other application
+  int32 status = CFE_TBL_Share( &DR_LC_WDTHandle, lcWdtTableName);
+  if(CFE_SUCCESS != status)
+  {
+      CFE_EVS_SendEvent(DR_TBL_SUB_ERR_EID, CFE_EVS_ERROR,
+			"Error initializing watchpoint definition table, "
+			"TblName=%s, RetCode=0x%08X", lcWdtTableName, status);
+  }
+
+  if(CFE_SUCCESS == status)
+  {
+    // Create the full name of the LCX Watchpoint Results Table (WRT), which is
+    // APP_NAME.TABLE_NAME
+    char lcWrtTableName[CFE_TBL_MAX_FULL_NAME_LEN];
+    snprintf(lcWrtTableName, CFE_TBL_MAX_FULL_NAME_LEN, "%s.%s",
+	     LC_APP_NAME, LC_WRT_TABLENAME);
+    
+    // Register for the table created by the other application
+    status = CFE_TBL_Share( &DR_LC_WRTHandle, lcWrtTableName);
+    if(CFE_SUCCESS != status)
+    {
+      CFE_EVS_SendEvent(DR_TBL_SUB_ERR_EID, CFE_EVS_ERROR,
+			"Error initializing watchpoint results table, "
+			"TblName=%s, RetCode=0x%08X", lcWrtTableName, status);
+    }
+  }
+
+  // Only LC could be notified of updates to the LC.WRT, since only a
+  // table's owner can call CFE_TBL_NotifyByMessage(), and LC updates it
+  // in place anyway. See DR_DIAGNOSE_ON_LC_SAMPLE for diagnosing in
+  // phase with LC's actionpoint sampling instead of on every wakeup.
+
+  return status;
+
+}
+
+int32 DR_UnregisterLcTables(void)
+{
+  int32 status = CFE_TBL_Unregister(DR_LC_WDTHandle);
+
+  if(CFE_SUCCESS == status)
+  {
+    status = CFE_TBL_Unregister(DR_LC_WRTHandle);
+  }
+  
+  return status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process a command pipe message                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 DR_AppPipe(CFE_SB_MsgPtr_t MessagePtr)
+{
+  int32           status      = CFE_SUCCESS;
+  CFE_SB_MsgId_t  MsgId;
+  
+  MsgId = CFE_SB_GetMsgId(DR_MsgPtr);
+  
+  switch (MsgId)
+  {
+  case DR_CMD_MID:
+    DR_ProcessGroundCommand();
+    break;
+    
+  case DR_SEND_HK_MID:
+    DR_ReportHousekeeping();
+    break;
+  case DR_WAKEUP_MID:
+    status = DR_Wakeup();
+    break;    
+#if DR_DIAGNOSE_ON_LC_SAMPLE
+  case LC_SAMPLE_AP_MID:
+    // The scheduler's command to LC to sample its actionpoints, which
+    // only times the diagnosis to LC's schedule. The watchpoint results
+    // may or may not have changed since the last one.
+    if(!DR_DiagnosisBlocked())
+    {
+      status = DR_Diagnose(DR_GetTimeMicros());
+    }
+    break;
+#endif
+  default:
+    DR_HkTelemetryPkt.dr_command_error_count++;
+    CFE_EVS_SendEvent(DR_COMMAND_ERR_EID,CFE_EVS_ERROR,
+		      "DR: invalid command packet,MID = 0x%x", MsgId);
+    break;
+  }
+  
+  return status;
+}
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* DR_ProcessGroundCommand() -- DR ground commands                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+void DR_ProcessGroundCommand(void)
+{
+    uint16 CommandCode;
+
+    CommandCode = CFE_SB_GetCmdCode(DR_MsgPtr);
+
+    /* Process "known" DR ground commands */
+    switch (CommandCode)
+    {
+        case DR_NOOP_CC:
+            DR_HkTelemetryPkt.dr_command_count++;
+            CFE_EVS_SendEvent(DR_COMMANDNOP_INF_EID,CFE_EVS_INFORMATION,
+			"DR: NOOP command");
+            break;
+
+        case DR_RESET_COUNTERS_CC:
+            DR_ResetCounters();
+            break;
+
+        case DR_CHANGE_MODE_CC:
+            DR_ChangeModeCommand();
+            break;
+
+        case DR_SEND_PERF_CC:
+            DR_SendPerfCommand();
+            break;
+
+        case DR_RESET_PERF_CC:
+            DR_ResetPerfCommand();
+            break;
+
+        /* default case already found during FC vs length test */
+        default:
+            break;
+    }
+    return;
+
+} /* End of DR_ProcessGroundCommand() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  DR_ResetCounters                                               */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         This function resets all the global counter variables that are     */
+/*         part of the task telemetry.                                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void DR_ResetCounters(void)
+{
+    /* Status of commands processed by the DR */
+    DR_HkTelemetryPkt.dr_command_count       = 0;
+    DR_HkTelemetryPkt.dr_command_error_count = 0;
+    DR_HkTelemetryPkt.dr_skipped_diagnosis_count = 0;
+    DR_HkTelemetryPkt.dr_mode_change_error_count = 0;
+    DR_HkTelemetryPkt.dr_diagnosis_error_count = 0;
+    DR_HkTelemetryPkt.dr_save_error_count = 0;
+
+    CFE_EVS_SendEvent(DR_COMMANDRST_INF_EID, CFE_EVS_INFORMATION,
+		"DR: RESET command");
+
+    return;
+
+} /* End of DR_ResetCounters() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  DR_ReportHousekeeping                                              */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         This function is triggered in response to a task telemetry request */
+/*         from the housekeeping task. This function will gather the DR       */
+/*         telemetry, packetize it and send it to the housekeeping task via   */
+/*         the software bus                                                   */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void DR_ReportHousekeeping(void)
+{
+    DR_HkTelemetryPkt.dr_mode_change_state = (uint8)dr_mode_change_state;
+    DR_HkTelemetryPkt.dr_mode = (uint32)dr_mode;
+    DR_HkTelemetryPkt.dr_requested_mode =
+      (DR_MODE_CHANGE_IDLE == dr_mode_change_state) ?
+      (uint32)dr_mode : (uint32)dr_mode_change_def.mode_index;
+    memcpy(DR_HkTelemetryPkt.dr_mode_change_step_usec,
+	   dr_mode_change_step_times, sizeof(dr_mode_change_step_times));
+
+    CFE_SB_TimeStampMsg((CFE_SB_Msg_t *) &DR_HkTelemetryPkt);
+    CFE_SB_SendMsg((CFE_SB_Msg_t *) &DR_HkTelemetryPkt);
+    return;
+
+} /* End of DR_ReportHousekeeping() */
+
+void    DR_ChangeModeCommand()
+{
+    int success = 1;
+    size_t ExpectLength = sizeof (dr_change_mode_cmd_type);
+    size_t ActualLength = CFE_SB_GetTotalMsgLength(DR_MsgPtr);
+    if (ActualLength != ExpectLength) {
+        CFE_EVS_SendEvent(DR_LEN_ERR_EID, CFE_EVS_ERROR,
+                          "DR Change Mode command with bad length (Expected %lu, Observed %lu)",
+                          (unsigned long)ExpectLength,
+                          (unsigned long)ActualLength);
+        success = 0;
+    }
+
+    dr_change_mode_cmd_type const *ptr =
+        (dr_change_mode_cmd_type *)DR_MsgPtr;
+
+    if (success) {
+        // DR_StartModeChange() reports the change. If it ended at once,
+        // a failed change is a command error; otherwise it goes on in
+        // the background, and DR_AdvanceModeChange() reports how it
+        // ends.
+        int32 status = DR_StartModeChange(ptr->NewMode);
+        if (CFE_SUCCESS != status) {
+            success = 0;
+        }
+    }
+
+    if (success) {
+        DR_HkTelemetryPkt.dr_command_count++;
+    } else {
+        DR_HkTelemetryPkt.dr_command_error_count++;
+    }
+
+    return;
+} /* End of DR_ChangeModeCommand() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  DR_SendPerfCommand                                                 */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Sends the wakeup timing statistics kept since DR started or the    */
+/*         last reset.                                                        */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void DR_SendPerfCommand(void)
+{
+    DR_HkTelemetryPkt.dr_command_count++;
+
+    CFE_SB_TimeStampMsg((CFE_SB_Msg_t *) &DR_PerfTelemetryPkt);
+    CFE_SB_SendMsg((CFE_SB_Msg_t *) &DR_PerfTelemetryPkt);
+    return;
+
+} /* End of DR_SendPerfCommand() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*  Name:  DR_ResetPerfCommand                                                */
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         Clears the wakeup timing statistics.                               */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void DR_ResetPerfCommand(void)
+{
+    for (int stage = 0; stage < DR_STATS_STAGE_COUNT; ++stage)
+    {
+        dr_reset_stats(&DR_PerfTelemetryPkt.stages[stage]);
+    }
+
+    DR_HkTelemetryPkt.dr_command_count++;
+    CFE_EVS_SendEvent(DR_PERF_RESET_INF_EID, CFE_EVS_INFORMATION,
+		      "DR: Performance statistics reset");
+    return;
+
+} /* End of DR_ResetPerfCommand() */
+
+uint32 DR_GetTimeMicros(void)
+{
+  // Only differences of these are used, so they may wrap. The PSP's
+  // timebase is monotonic, unlike OS_GetLocalTime(), which is the
+  // settable clock, so setting the time can't skew the step timeouts
+  // and the stage statistics.
+  OS_time_t now;
+  CFE_PSP_GetTime(&now);
+  return (now.seconds * 1000000u) + now.microsecs;
+}
+
+void DR_RecordStageTime(dr_stats_stage_type stage, uint32 start_usec)
+{
+  dr_record_stats(&DR_PerfTelemetryPkt.stages[stage],
+		  DR_GetTimeMicros() - start_usec);
+}
+
+
+int32 DR_Wakeup(void)
+{
+
+  uint32 const wakeup_usec = DR_GetTimeMicros();
+
+  // First manage our tables on every wakeup.
+  CFE_ES_PerfLogEntry(DR_MANAGE_TBL_PERF_ID);
+  int32 status = DR_ManageTables();
+  CFE_ES_PerfLogExit(DR_MANAGE_TBL_PERF_ID);
+  DR_RecordStageTime(DR_STATS_MANAGE_TABLES, wakeup_usec);
+  
+  // Now do a diagnosis. When diagnosing on LC actionpoint samples, the
+  // wakeup only diagnoses if no sample command has come for too long.
+  bool diagnose = !DR_DiagnosisBlocked();
+#if DR_DIAGNOSE_ON_LC_SAMPLE
+  ++dr_wakeups_since_diagnosis;
+  diagnose = diagnose &&
+    (dr_wakeups_since_diagnosis >= DR_LC_SAMPLE_TIMEOUT_WAKEUPS);
+#endif
+
+  if( (CFE_SUCCESS == status) && diagnose )
+  {
+    status = DR_Diagnose(wakeup_usec);
+  }
+  
+  return status;
+
+}
+
+int32 DR_Diagnose(uint32 wakeup_usec)
+{
+  uint32 stage_usec = DR_GetTimeMicros();
+  dr_wakeups_since_diagnosis = 0;
+
+  ///////////////////////////////////////
+  // Process the test results, for the size of the loaded model. A
+  // model that failed to compile has no tests.
+  dr_model_type const * const model = dr_active_model;
+  dr_test_result_type * const test_results = dr_test_results;
+  uint32_t num_tests = model->num_tests;
+  
+  bool results_changed = true;
+  int32 status = dr_process_tests(DR_LC_WRTHandle, &model->gather_plan,
+			    num_tests,
+			    test_results,
+			    dr_prev_test_results,
+			    &results_changed);
+
+  DR_RecordStageTime(DR_STATS_GATHER, stage_usec);
+
+  ///////////////////////////////////////
+  // Perform the diagnosis
+  DR_Diagnosis_Msg.num_failure_modes = model->num_failure_modes;
+  
+  CFE_ES_PerfLogEntry(DR_SOLVE_PERF_ID);
+  stage_usec = DR_GetTimeMicros();
+  
+  if(dr_diagnosis_current && !results_changed)
+  {
+    // Nothing changed since the last diagnosis, so it stands, and is
+    // only sent again with a new time stamp.
+    DR_HkTelemetryPkt.dr_skipped_diagnosis_count++;
+  }
+  else
+  {
+    DR_SolveModel(model, num_tests, test_results);
+
+    // The diagnosis is only good for the next wakeup's test results if
+    // these were actually gathered, and so saved as the previous ones.
+    dr_diagnosis_current = (CFE_SUCCESS == status);
+
+    // Only actual solves are timed
+    DR_RecordStageTime(DR_STATS_SOLVE, stage_usec);
+  }
+
+  CFE_ES_PerfLogExit(DR_SOLVE_PERF_ID);
+
+  if(DR_Diagnosis_Msg.error != DR_ERROR_NO_ERROR)
+  {
+    DR_HkTelemetryPkt.dr_diagnosis_error_count++;
+    if(DR_Diagnosis_Msg.error != dr_last_diagnosis_error)
+    {
+      CFE_EVS_SendEvent(DR_DIAGNOSIS_ERR_EID, CFE_EVS_ERROR,
+			"DR: diagnosis of mode %lu failed, error = %d",
+			(unsigned long)dr_mode, DR_Diagnosis_Msg.error);
+    }
+    status = DR_DIAGNOSIS_ERROR;
+  }
+  dr_last_diagnosis_error = DR_Diagnosis_Msg.error;
+
+#ifdef DR_TRACE_DR_TRACE_SUSPECTS_BADS
+  OS_printf("dr: suspect and bad failure modes:\n");
+  for(size_t i = 0; i < DR_Diagnosis_Msg.num_failure_modes; ++i)
+  {
+    if( (DR_FAILURE_MODE_SUSPECT == DR_Diagnosis_Msg.failure_modes[i]) ||
+	(DR_FAILURE_MODE_BAD == DR_Diagnosis_Msg.failure_modes[i]) )
+      {
+	OS_printf("   index %u = %u\n", i, DR_Diagnosis_Msg.failure_modes[i]);
+      }
+
+  }
+#endif
+  
+
+  // Send the results to the software bus. This is a best-effort send
+  // like all sw bus messages and if it fails it would be logged
+  // by cFE. 
+  // Only the failure modes of the loaded model are sent.
+  CFE_ES_PerfLogEntry(DR_PUBLISH_PERF_ID);
+  stage_usec = DR_GetTimeMicros();
+  CFE_SB_SetTotalMsgLength((CFE_SB_Msg_t *) &DR_Diagnosis_Msg,
+    DR_DIAGNOSIS_MSG_LNGTH(DR_Diagnosis_Msg.num_failure_modes));
+  CFE_SB_TimeStampMsg((CFE_SB_Msg_t *) &DR_Diagnosis_Msg);
+  CFE_SB_SendMsg((CFE_SB_Msg_t *) &DR_Diagnosis_Msg);
+  DR_RecordStageTime(DR_STATS_PUBLISH, stage_usec);
+  DR_RecordStageTime(DR_STATS_WAKEUP_TO_PUBLISH, wakeup_usec);
+  CFE_ES_PerfLogExit(DR_PUBLISH_PERF_ID);
+  
+  
+  // Write the results to the files
+  CFE_ES_PerfLogEntry(DR_SAVE_PERF_ID);
+  stage_usec = DR_GetTimeMicros();
+  static int iteration = 0;
+#if DR_RESULTS_LOG_FORMAT == DR_RESULTS_BINARY
+  // A new segment of the log starts with the first diagnosis of each
+  // model and mode. The record has the time stamp the diagnosis message
+  // was sent with.
+  dr_error_type save_error = DR_ERROR_NO_ERROR;
+
+  if(dr_log_header_stale)
+  {
+    save_error = DR_SaveResultsLogHeader(model);
+    dr_log_header_stale = (DR_ERROR_NO_ERROR != save_error);
+  }
+
+  if(DR_ERROR_NO_ERROR == save_error)
+  {
+    CFE_TIME_SysTime_t const time =
+      CFE_SB_GetMsgTime((CFE_SB_MsgPtr_t) &DR_Diagnosis_Msg);
+
+    save_error = dr_save_results_log(
+      iteration,
+      time.Seconds,
+      time.Subseconds,
+      DR_Diagnosis_Msg.error,
+      num_tests,
+      test_results,
+      DR_Diagnosis_Msg.num_failure_modes,
+      DR_Diagnosis_Msg.failure_modes);
+  }
+#else
+  dr_error_type save_error = dr_save_results(
+    iteration,
+    DR_Diagnosis_Msg.error,
+    num_tests,
+    test_results,
+    DR_Diagnosis_Msg.num_failure_modes,
+    DR_Diagnosis_Msg.failure_modes);
+#endif
+  iteration++; 
+  DR_RecordStageTime(DR_STATS_SAVE, stage_usec);
+  CFE_ES_PerfLogExit(DR_SAVE_PERF_ID);
+  
+  if(save_error != DR_ERROR_NO_ERROR)
+  {
+    DR_HkTelemetryPkt.dr_save_error_count++;
+    if(save_error != dr_last_save_error)
+    {
+      CFE_EVS_SendEvent(DR_RESULTS_SAVE_ERR_EID, CFE_EVS_ERROR,
+			"DR: saving the diagnosis results failed, error = %d",
+			save_error);
+    }
+    status = DR_RESULTS_SAVE_ERROR;
+  }
+  dr_last_save_error = save_error;
+
+#ifdef DR_TRACE
+  dr_print_results(DR_Diagnosis_Msg.error, &model->bitset,
+		   num_tests, test_results,
+		   DR_Diagnosis_Msg.num_failure_modes,
+		   DR_Diagnosis_Msg.failure_modes);
+#endif // DR_TRACE
+  
+  return status;
+}
+
+#if DR_RESULTS_LOG_FORMAT == DR_RESULTS_BINARY
+dr_error_type DR_SaveResultsLogHeader(dr_model_type const * const model)
+{
+  // A cached model was compiled from the tables of its cache entry, any
+  // other model from what the DR tables hold now.
+  dr_log_header_type header;
+  memset(&header, 0, sizeof(header));
+  header.num_tests = model->num_tests;
+  header.num_failure_modes = model->num_failure_modes;
+  header.mode = dr_mode;
+
+  dr_cached_model_type const * cached = NULL;
+  for(uint32 i = 0; (i < dr_model_cache_count) && (NULL == cached); ++i)
+  {
+    if(model == &dr_model_cache[i].model)
+    {
+      cached = &dr_model_cache[i];
+    }
+  }
+
+  if(NULL != cached)
+  {
+    strncpy(header.d_matrix_tbl_filename, cached->d_matrix_tbl_filename,
+	    DR_LOG_FILENAME_LENGTH - 1);
+    strncpy(header.wtm_tbl_filename, cached->wtm_tbl_filename,
+	    DR_LOG_FILENAME_LENGTH - 1);
+    header.d_matrix_crc = cached->d_matrix_crc;
+    header.wtm_crc = cached->wtm_crc;
+  }
+  else
+  {
+    CFE_TBL_Info_t table_info;
+
+    if(CFE_SUCCESS == CFE_TBL_GetInfo(&table_info,
+				      DR_APP_NAME"."DR_D_MATRIX_NAME))
+    {
+      strncpy(header.d_matrix_tbl_filename, table_info.LastFileLoaded,
+	      DR_LOG_FILENAME_LENGTH - 1);
+      header.d_matrix_crc = table_info.Crc;
+    }
+
+    if(CFE_SUCCESS == CFE_TBL_GetInfo(&table_info, DR_APP_NAME"."DR_WTM_NAME))
+    {
+      strncpy(header.wtm_tbl_filename, table_info.LastFileLoaded,
+	      DR_LOG_FILENAME_LENGTH - 1);
+      header.wtm_crc = table_info.Crc;
+    }
+  }
+
+  return dr_save_results_log_header(&header);
+}
+#endif
+
+void DR_SolveModel(dr_model_type const * const model,
+		   uint32 num_tests,
+		   dr_test_result_type const * const test_results)
+{
+  switch( (DR_ERROR_NO_ERROR == model->error) ?
+	  dr_diagnosis_engine : DR_ENGINE_COUNT )
+  {
+  case DR_ENGINE_REFERENCE:
+  case DR_ENGINE_IMPLICATION_COUNT:
+    // These solve the fixed-size d-matrix table, not the packed table
+    // the app loads. They remain for the unit tests and MATLAB.
+    DR_Diagnosis_Msg.error = DR_ERROR_UNSUPPORTED_ENGINE;
+    break;
+  case DR_ENGINE_INCREMENTAL:
+    DR_Diagnosis_Msg.error = dr_process_incremental_d_matrix(
+      &model->bitset, &dr_incremental_state, num_tests, test_results,
+      DR_Diagnosis_Msg.num_failure_modes,
+      DR_Diagnosis_Msg.failure_modes);
+    break;
+  case DR_ENGINE_SPARSE:
+    DR_Diagnosis_Msg.error = model->sparse_error;
+    if(DR_ERROR_NO_ERROR == DR_Diagnosis_Msg.error)
+    {
+      DR_Diagnosis_Msg.error = dr_process_sparse_d_matrix(
+        &model->sparse, num_tests, test_results,
+        DR_Diagnosis_Msg.num_failure_modes,
+        DR_Diagnosis_Msg.failure_modes);
+    }
+    break;
+  case DR_ENGINE_COMPONENT:
+    DR_Diagnosis_Msg.error = model->sparse_error;
+    if(DR_ERROR_NO_ERROR == DR_Diagnosis_Msg.error)
+    {
+      DR_Diagnosis_Msg.error = dr_process_component_d_matrix(
+        &model->sparse, model->components, &dr_component_state,
+        num_tests, test_results,
+        DR_Diagnosis_Msg.num_failure_modes,
+        DR_Diagnosis_Msg.failure_modes);
+    }
+    break;
+  case DR_ENGINE_BITSET:
+    DR_Diagnosis_Msg.error = dr_process_bitset_d_matrix(
+      &model->bitset, num_tests, test_results,
+      DR_Diagnosis_Msg.num_failure_modes,
+      DR_Diagnosis_Msg.failure_modes);
+    break;
+  case DR_ENGINE_COUNT:
+  default:
+    DR_Diagnosis_Msg.error = DR_ERROR_UNSUPPORTED_ENGINE;
+    break;
+  }
+  
+  // A model that failed to compile is never solved, its error is
+  // reported instead.
+  if(DR_ERROR_NO_ERROR != model->error)
+  {
+    DR_Diagnosis_Msg.error = model->error;
+  }
+}
+
+int32 DR_ManageTables(void)
+{
+  // Releasing, managing and re-acquiring every table is a lot of table
+  // calls per wakeup, and there is rarely anything for them to do. So
+  // only go through that when a table needs it.
+  //
+  // While a mode change is in progress, a table load from the ground
+  // would be compiled into the table model the change is going to switch
+  // to, and switched to before the change is done. So the tables are
+  // left alone until the change is done; the change manages them itself
+  // when it loads the new mode's tables.
+  int32 status = CFE_SUCCESS;
+
+  if( (DR_MODE_CHANGE_IDLE == dr_mode_change_state) &&
+      (!dr_table_addresses_held || DR_TableActionPending()) )
+  {
+    status = DR_RefreshTables(true);
+  }
+
+  return status;
+}
+
+int32 DR_RefreshTables(bool use_model)
+{
+    
+  // Must release loadable table pointers before allowing updates
+#ifdef DR_TRACE
+  OS_printf("DR: DR_RefreshTables(): Releasing table addresses\n");
+#endif
+  CFE_TBL_ReleaseAddress(dr_mode_def_handle);
+  CFE_TBL_ReleaseAddress(dr_d_matrix_handle);
+  CFE_TBL_ReleaseAddress(dr_wtm_handle);
+  
+  // Manage the tables (I need to find out what is involved here)
+#ifdef DR_TRACE
+  OS_printf("DR: DR_RefreshTables(): Managing the tables\n");
+#endif
+  CFE_TBL_Manage(dr_mode_def_handle);
+  CFE_TBL_Manage(dr_d_matrix_handle);
+  CFE_TBL_Manage(dr_wtm_handle);
+  
+  // Re-acquire the pointers 
+#ifdef DR_TRACE
+  OS_printf("DR: DR_RefreshTables(): Re-acquiring the addresses\n");
+#endif
+  int32 status = CFE_TBL_GetAddress((void *)&dr_mode_def_ptr,
+			      dr_mode_def_handle);
+  if(CFE_TBL_INFO_UPDATED == status)
+  {
+    status = CFE_SUCCESS;
+  }
+  if(CFE_SUCCESS != status)
+  {
+    OS_printf("DR: DR_RefreshTables(): Error getting address for mode def table:"
+		"status = 0x%08X\n", status);
+  }
+  
+  // The model depends on both the d-matrix and the wtm tables, so it is
+  // recompiled when either is updated.
+  bool model_updated = false;
+
+  if (CFE_SUCCESS == status)
+  {
+    status = CFE_TBL_GetAddress((void *)&dr_d_matrix_ptr,
+				dr_d_matrix_handle);
+    if(CFE_TBL_INFO_UPDATED == status)
+    {
+      model_updated = true;
+      status = CFE_SUCCESS;
+    }
+    if(CFE_SUCCESS != status)
+    {
+      OS_printf("DR: DR_RefreshTables(): Error getting address for d matrix table: "
+		"status = 0x%08X\n", status);
+    }
+  }
+  
+  if (CFE_SUCCESS == status)
+  {
+    status = CFE_TBL_GetAddress((void *)&dr_wtm_ptr,
+				dr_wtm_handle);
+    if(CFE_TBL_INFO_UPDATED == status)
+    {
+      model_updated = true;
+      status = CFE_SUCCESS;
+    }
+    if(CFE_SUCCESS != status)
+    {
+      OS_printf("DR: DR_RefreshTables(): Error getting address for wtm table:"
+		"status = 0x%08X\n", status);
+    }
+  }
+
+  if ( (CFE_SUCCESS == status) && model_updated )
+  {
+    dr_model = (dr_active_model == &dr_table_models[0]) ?
+      &dr_table_models[1] : &dr_table_models[0];
+    dr_error_type const error = dr_compile_model(dr_model, dr_d_matrix_ptr,
+						 dr_wtm_ptr);
+    if(DR_ERROR_NO_ERROR != error)
+    {
+      CFE_EVS_SendEvent(DR_D_MATRIX_ERR_EID, CFE_EVS_ERROR,
+			"DR: d-matrix and wtm tables don't make a valid "
+			"model, error = %d", error);
+    }
+    else if(DR_ERROR_NO_ERROR != dr_model->sparse_error)
+    {
+      CFE_EVS_SendEvent(DR_D_MATRIX_ERR_EID, CFE_EVS_ERROR,
+			"DR: d-matrix table has too many entries for the "
+			"sparse engine, error = %d", dr_model->sparse_error);
+    }
+
+    // Newly loaded tables replace a cached model too, unless a mode
+    // change compiled them to switch to later
+    if(use_model)
+    {
+      DR_UseModel(dr_model);
+    }
+  }
+
+  dr_table_addresses_held = (CFE_SUCCESS == status);
+  
+  return status;
+  
+}
+
+bool DR_TableActionPending(void)
+{
+  // CFE_TBL_GetStatus() returns CFE_SUCCESS when the table has nothing
+  // pending, an info code for a pending update, validation or dump, and
+  // an error otherwise. Anything but success needs the tables managed,
+  // which also reports the errors.
+  CFE_TBL_Handle_t const handles[] =
+    { dr_mode_def_handle, dr_d_matrix_handle, dr_wtm_handle };
+  bool pending = false;
+
+  for(size_t i = 0; (i < (sizeof(handles) / sizeof(handles[0]))) && !pending; ++i)
+  {
+    pending = (CFE_SUCCESS != CFE_TBL_GetStatus(handles[i]));
+  }
+
+  return pending;
+}
+
+bool DR_DiagnosisBlocked(void)
+{
+  // From when LC is asked to activate a new mode's watchpoint definition
+  // table until DR switches to the new mode's model, LC's watchpoint
+  // results may be of either mode. The same goes while LC's table
+  // doesn't match the mode, which is checked again on each call until
+  // it does.
+  if(dr_lc_wdt_mismatch &&
+     (CFE_SUCCESS == DR_CheckLcWdtFile(dr_mode_lc_wdt_tbl_filename)))
+  {
+    dr_lc_wdt_mismatch = false;
+    CFE_EVS_SendEvent(DR_LC_WDT_MATCHED_INF_EID, CFE_EVS_INFORMATION,
+		      "LC watchpoint definition table %s matches mode %lu "
+		      "again, diagnosing", dr_mode_lc_wdt_tbl_filename,
+		      (unsigned long)dr_mode);
+  }
+
+  return dr_lc_wdt_mismatch ||
+    (DR_MODE_CHANGE_ACTIVATING_LC_WDT == dr_mode_change_state);
+}
+
+int32 DR_ValidateModeDefTable(void * TblPtr)
+{
+  // Every entry is checked, used or not, since any of them may be
+  // changed to. A zero-filled entry gets DR_ENGINE_INCREMENTAL.
+  int32 status = CFE_SUCCESS;
+  dr_mode_def_entry_type const * const modes =
+    (dr_mode_def_entry_type const *)TblPtr;
+
+  for(uint32 i = 0; (i < DR_MAX_NUM_MODES) && (CFE_SUCCESS == status); ++i)
+  {
+    if(!DR_EngineSupported(modes[i].engine))
+    {
+      CFE_EVS_SendEvent(DR_TBL_VALIDATION_ERR_EID, CFE_EVS_ERROR,
+			"DR: mode definition table failed validation, "
+			"entry %lu has unsupported engine %d",
+			(unsigned long)i, (int)modes[i].engine);
+      status = DR_TABLE_VALIDATION_ERROR;
+    }
+  }
+
+  return status;
+}
+
+int32 DR_ValidateDMatrixTable(void * TblPtr)
+{
+  int32 status = CFE_SUCCESS;
+  dr_error_type const error =
+    dr_validate_d_matrix_tbl((dr_d_matrix_packed_tbl_type const *)TblPtr);
+
+  if(DR_ERROR_NO_ERROR != error)
+  {
+    CFE_EVS_SendEvent(DR_TBL_VALIDATION_ERR_EID, CFE_EVS_ERROR,
+		      "DR: d-matrix table failed validation, error = %d",
+		      error);
+    status = DR_TABLE_VALIDATION_ERROR;
+  }
+
+  return status;
+}
+
+int32 DR_ValidateWtmTable(void * TblPtr)
+{
+  int32 status = CFE_SUCCESS;
+  dr_error_type const error =
+    dr_validate_wtm_tbl(LC_MAX_WATCHPOINTS, DR_MAX_MODEL_TESTS,
+			(dr_wtm_entry_type const *)TblPtr);
+
+  if(DR_ERROR_NO_ERROR != error)
+  {
+    CFE_EVS_SendEvent(DR_TBL_VALIDATION_ERR_EID, CFE_EVS_ERROR,
+		      "DR: wtm table failed validation, error = %d",
+		      error);
+    status = DR_TABLE_VALIDATION_ERROR;
+  }
+
+  return status;
+}
+
+bool DR_EngineSupported(dr_engine_type engine)
+{
+  // DR_ENGINE_REFERENCE and DR_ENGINE_IMPLICATION_COUNT solve the
+  // fixed-size d-matrix table, not the packed table the app loads. They
+  // remain for the unit tests and MATLAB.
+  return (DR_ENGINE_INCREMENTAL == engine) ||
+    (DR_ENGINE_BITSET == engine) ||
+    (DR_ENGINE_SPARSE == engine) ||
+    (DR_ENGINE_COMPONENT == engine);
+}
+
+bool DR_ModelSupportsEngine(dr_model_type const * model,
+			    dr_engine_type engine)
+{
+  // The sparse engines also need the model's sparse form, which may not
+  // fit its storage even when the bitsets do.
+  bool const needs_sparse = (DR_ENGINE_SPARSE == engine) ||
+    (DR_ENGINE_COMPONENT == engine);
+
+  return (DR_ERROR_NO_ERROR == model->error) &&
+    DR_EngineSupported(engine) &&
+    (!needs_sparse || (DR_ERROR_NO_ERROR == model->sparse_error));
+}
+
+int32 DR_ChangeMode(int32 new_mode)
+{
+  // At startup there is no mode to keep diagnosing with, so just wait
+  // for the mode change to finish.
+  int32 status = DR_StartModeChange(new_mode);
+
+  while( (CFE_SUCCESS == status) &&
+	 (DR_MODE_CHANGE_IDLE != dr_mode_change_state) )
+  {
+    OS_TaskDelay(DR_ModeChangeWaitMillis());
+    DR_AdvanceModeChange();
+  }
+
+  if(CFE_SUCCESS == status)
+  {
+    status = dr_mode_change_status;
+  }
+
+  return status;
+}
+
+int32 DR_StartModeChange(int32 new_mode)
+{
+  // For DR, changing mode basically means loading new tables to use
+  // for diagnosis. This functionality was developed but is not in
+  // use yet. The intent is that DR will change modes based on receiving
+  // an external command. It would also be possible for DR to change
+  // modes based on sensor values or even additional LC watchpoint results.
+  // Exactly which to implement is a topic for future development. 
+  //
+  // The new mode's model is loaded and compiled first, or found in the
+  // cache, while DR goes on diagnosing with the current mode, and then
+  // the LC watchpoint definition table is loaded, which takes several
+  // seconds. Loading a table or reading a table file to check it takes
+  // a while too, so this only starts the change, and
+  // DR_AdvanceModeChange() carries it on from the runloop a step at a
+  // time. Once LC is asked to activate the table, switching to the model
+  // is all that is left.
+  
+  int32 status = CFE_SUCCESS;
+
+  if(DR_MODE_CHANGE_IDLE != dr_mode_change_state)
+  {
+    OS_printf("DR: the change to mode %ld is still in progress.\n",
+	      (long)dr_mode_change_def.mode_index);
+    status = CFE_SEVERITY_ERROR;
+  }
+  
+  if(CFE_SUCCESS == status)
+  {
+    // Read the mode definition table to find what files contain
+    // the tables we will load. The entry is copied, since the mode
+    // definition table may be updated before the change is done.
+    int i;
+    for(i = 0; i < DR_MAX_NUM_MODES; ++i)
+      if(dr_mode_def_ptr[i].mode_index == new_mode)
+	break;
+
+    if (i < DR_MAX_NUM_MODES)
+    {
+      dr_mode_def_entry_type const * const entry = &dr_mode_def_ptr[i];
+      if ((!*entry->d_matrix_tbl_filename) ||
+          (!*entry->wtm_tbl_filename) ||
+          (!*entry->lc_wdt_tbl_filename) ||
+          (!DR_EngineSupported(entry->engine))) {
+        OS_printf("DR: mode %ld (table entry %d) is not valid.\n", (long)new_mode, i);
+        status = CFE_SEVERITY_ERROR;
+      } else {
+        dr_mode_change_def = *entry;
+      }
+    } else {
+      OS_printf("DR: mode %ld is not valid (not in the table).\n", (long)new_mode);
+      status = CFE_SEVERITY_ERROR;
+    }
+  }
+
+  // The change is reported as started before anything else about it
+  if(CFE_SUCCESS == status)
+  {
+    CFE_EVS_SendEvent(DR_MODE_CHANGE_STARTED_INF_EID, CFE_EVS_INFORMATION,
+		      "Changing to mode %lu", (unsigned long)new_mode);
+  }
+  else
+  {
+    CFE_EVS_SendEvent(DR_COMMAND_ERR_EID, CFE_EVS_ERROR,
+		      "Unable to change to mode %lu, error code is 0x%08lX (%ld)",
+		      (unsigned long)new_mode,
+		      0xFFFFFFFF & (unsigned long)status, (long)status);
+  }
+
+  // If the request was invalid, avoid doing anything to change state.
+  // A cached mode's tables aren't loaded.
+  if(CFE_SUCCESS == status)
+  {
+    dr_mode_change_start_usec = DR_GetTimeMicros();
+    memset(dr_mode_change_step_times, 0, sizeof(dr_mode_change_step_times));
+
+    DR_StartModeChangeStep( (NULL != DR_FindCachedModel(&dr_mode_change_def)) ?
+			    DR_MODE_CHANGE_LOADING_MODEL :
+			    DR_MODE_CHANGE_LOADING_D_MATRIX );
+  }
+  
+  return status;
+  
+}
+
+void DR_AdvanceModeChange(void)
+{
+  // Table services has LC validate and activate its table in LC's own
+  // time, usually within a few milliseconds but sometimes seconds. So
+  // the table is polled soon after each step starts, then less and
+  // less often, up to every DR_TABLE_POLL_INTERVAL_MILLIS. The steps
+  // loading the DR tables and checking LC's are done on their first
+  // poll, one per call, so the runloop handles its messages in between.
+  uint32 const elapsed_millis = (DR_MODE_CHANGE_IDLE == dr_mode_change_state) ?
+    0 : (DR_GetTimeMicros() - dr_mode_change_step_usec) / 1000;
+
+  if( (DR_MODE_CHANGE_IDLE != dr_mode_change_state) &&
+      (elapsed_millis >= dr_mode_change_poll_millis) )
+  {
+    dr_mode_change_state_type const step = dr_mode_change_state;
+    int32 const table_status = CFE_TBL_GetStatus(DR_LC_WDTHandle);
+
+    // Before table services gets to a command the table has nothing
+    // pending either, so that only ends a step once the old fixed wait
+    // has passed, in case the pending state came and went between polls.
+    bool const settled = (CFE_SUCCESS == table_status) &&
+      (elapsed_millis >= DR_TABLE_POLL_INTERVAL_MILLIS);
+
+    switch(dr_mode_change_state)
+    {
+    case DR_MODE_CHANGE_LOADING_D_MATRIX:
+      DR_ContinueModeChange(
+	DR_LoadTableFile(dr_d_matrix_handle, DR_APP_NAME"."DR_D_MATRIX_NAME,
+			 dr_mode_change_def.d_matrix_tbl_filename),
+	DR_MODE_CHANGE_LOADING_WTM);
+      break;
+    case DR_MODE_CHANGE_LOADING_WTM:
+      DR_ContinueModeChange(
+	DR_LoadTableFile(dr_wtm_handle, DR_APP_NAME"."DR_WTM_NAME,
+			 dr_mode_change_def.wtm_tbl_filename),
+	DR_MODE_CHANGE_LOADING_MODEL);
+      break;
+    case DR_MODE_CHANGE_LOADING_MODEL:
+      // A mode whose model can't be loaded leaves LC alone
+      DR_ContinueModeChange(DR_LoadModeModel(&dr_mode_change_def),
+			    DR_MODE_CHANGE_CHECKING_LC_WDT);
+      break;
+    case DR_MODE_CHANGE_CHECKING_LC_WDT:
+      DR_LoadLcWdt();
+      break;
+    case DR_MODE_CHANGE_LOADING_LC_WDT:
+      // Table services asks LC for the validation once the load is done
+      if(CFE_TBL_INFO_VALIDATION_PENDING == table_status)
+      {
+	OS_printf("DR: DR_AdvanceModeChange(): Waiting on LC table validation...\n");
+	DR_StartModeChangeStep(DR_MODE_CHANGE_VALIDATING_LC_WDT);
+      }
+      else if(settled)
+      {
+	DR_ActivateLcWdt();
+      }
+      break;
+    case DR_MODE_CHANGE_VALIDATING_LC_WDT:
+      if(CFE_SUCCESS == table_status)
+      {
+	DR_ActivateLcWdt();
+      }
+      break;
+    case DR_MODE_CHANGE_ACTIVATING_LC_WDT:
+      if(DR_LcWdtUpdated() || settled)
+      {
+	DR_StartModeChangeStep(DR_MODE_CHANGE_SWITCHING_MODEL);
+	DR_FinishModeChange(DR_SwitchMode());
+      }
+      break;
+    case DR_MODE_CHANGE_SWITCHING_MODEL:
+    case DR_MODE_CHANGE_IDLE:
+    case DR_MODE_CHANGE_STATE_COUNT:
+    default:
+      break;
+    }
+
+    // A step that is still waiting is polled again later
+    if(step == dr_mode_change_state)
+    {
+      if(elapsed_millis > DR_TABLE_WAIT_TIMEOUT_MILLIS)
+      {
+	DR_FinishModeChange((CFE_SUCCESS != table_status) ?
+			    table_status : DR_WATCHPOINT_TABLE_LOAD_ERROR);
+      }
+      else
+      {
+	dr_mode_change_poll_interval_millis *= 2;
+	if(dr_mode_change_poll_interval_millis > DR_TABLE_POLL_INTERVAL_MILLIS)
+	{
+	  dr_mode_change_poll_interval_millis = DR_TABLE_POLL_INTERVAL_MILLIS;
+	}
+	dr_mode_change_poll_millis = elapsed_millis +
+	  dr_mode_change_poll_interval_millis;
+      }
+    }
+  }
+}
+
+int32 DR_ModeChangeWaitMillis(void)
+{
+  // How long the runloop may pend for messages before the mode change
+  // in progress needs polling again.
+  int32 wait_millis = 500;
+
+  if(DR_MODE_CHANGE_IDLE != dr_mode_change_state)
+  {
+    uint32 const elapsed_millis =
+      (DR_GetTimeMicros() - dr_mode_change_step_usec) / 1000;
+    wait_millis = (elapsed_millis < dr_mode_change_poll_millis) ?
+      (int32)(dr_mode_change_poll_millis - elapsed_millis) : 1;
+  }
+
+  return wait_millis;
+}
+
+void DR_StartModeChangeStep(dr_mode_change_state_type step)
+{
+  uint32 const now_usec = DR_GetTimeMicros();
+
+  if(DR_MODE_CHANGE_IDLE != dr_mode_change_state)
+  {
+    dr_mode_change_step_times[dr_mode_change_state] =
+      now_usec - dr_mode_change_step_usec;
+  }
+
+  dr_mode_change_state = step;
+  dr_mode_change_step_usec = now_usec;
+  dr_mode_change_poll_interval_millis = DR_TABLE_FIRST_POLL_MILLIS;
+  dr_mode_change_poll_millis = DR_TABLE_FIRST_POLL_MILLIS;
+}
+
+void DR_ContinueModeChange(int32 status,
+			   dr_mode_change_state_type next_step)
+{
+  // A failed load still has the DR table addresses re-acquired, so a
+  // table that was loaded is compiled now, into the table model not in
+  // use, and not switched to by a later wakeup.
+  if(CFE_SUCCESS == status)
+  {
+    DR_StartModeChangeStep(next_step);
+  }
+  else
+  {
+    if(!dr_table_addresses_held)
+    {
+      DR_RefreshTables(false);
+    }
+    DR_FinishModeChange(status);
+  }
+}
+
+void DR_FinishModeChange(int32 status)
+{
+  unsigned long const new_mode = (unsigned long)dr_mode_change_def.mode_index;
+  dr_mode_change_state_type const step = dr_mode_change_state;
+
+  // The time of the last step, and of the whole change
+  DR_StartModeChangeStep(DR_MODE_CHANGE_IDLE);
+  dr_mode_change_step_times[DR_MODE_CHANGE_IDLE] =
+    dr_mode_change_step_usec - dr_mode_change_start_usec;
+  dr_mode_change_status = status;
+
+  if(CFE_SUCCESS == status)
+  {
+    CFE_EVS_SendEvent(DR_MODE_CHANGED_INFO_EID, CFE_EVS_INFORMATION,
+		      "Switched to mode %lu in %lu ms", new_mode,
+		      (unsigned long)(dr_mode_change_step_times[DR_MODE_CHANGE_IDLE] / 1000));
+  }
+  else
+  {
+    DR_HkTelemetryPkt.dr_mode_change_error_count++;
+    CFE_EVS_SendEvent(DR_COMMAND_ERR_EID, CFE_EVS_ERROR,
+		      "Unable to change to mode %lu, error code is 0x%08lX (%ld)",
+		      new_mode, 0xFFFFFFFF & (unsigned long)status,
+		      (long)status);
+  }
+
+  // Once LC was asked to activate the new mode's watchpoint definition
+  // table, a failed change may leave LC watching the new mode's
+  // watchpoints while DR keeps the old mode's model. DR doesn't diagnose
+  // until that is resolved.
+  if( (CFE_SUCCESS != status) &&
+      ( (DR_MODE_CHANGE_ACTIVATING_LC_WDT == step) ||
+	(DR_MODE_CHANGE_SWITCHING_MODEL == step) ) &&
+      (CFE_SUCCESS != DR_CheckLcWdtFile(dr_mode_lc_wdt_tbl_filename)) )
+  {
+    dr_lc_wdt_mismatch = true;
+    CFE_EVS_SendEvent(DR_LC_WDT_MISMATCH_ERR_EID, CFE_EVS_ERROR,
+		      "LC watchpoint definition table doesn't match mode %lu, "
+		      "diagnosis stopped until LC has %s again or a mode "
+		      "change succeeds", (unsigned long)dr_mode,
+		      dr_mode_lc_wdt_tbl_filename);
+  }
+}
+
+void DR_LoadLcWdt(void)
+{
+  // If LC already has the new mode's watchpoint definition table, there
+  // is nothing to wait for. Mode pairs often share their watchpoints.
+  if(DR_TableHasFile(LC_APP_NAME"."LC_WDT_TABLENAME,
+		     dr_mode_change_def.lc_wdt_tbl_filename))
+  {
+    DR_StartModeChangeStep(DR_MODE_CHANGE_SWITCHING_MODEL);
+    DR_FinishModeChange(DR_SwitchMode());
+  }
+  else
+  {
+    // Must release loadable table pointers before making updates.
+    // Table services handles its commands in order, so the
+    // validation can be asked for along with the load.
+    CFE_TBL_ReleaseAddress(DR_LC_WDTHandle);
+    DR_StartModeChangeStep(DR_MODE_CHANGE_LOADING_LC_WDT);
+    DR_SendLcWdtCommand(CFE_TBL_LOAD_CC);
+    DR_SendLcWdtCommand(CFE_TBL_VALIDATE_CC);
+  }
+}
+
+void DR_ActivateLcWdt(void)
+{
+  // The activation is seen by the table's update time changing, so
+  // note it first.
+  CFE_TBL_Info_t lc_wdt_info;
+  memset(&lc_wdt_info, 0, sizeof(lc_wdt_info));
+  CFE_TBL_GetInfo(&lc_wdt_info, LC_APP_NAME"."LC_WDT_TABLENAME);
+  dr_lc_wdt_update_seconds = lc_wdt_info.TimeOfLastUpdateSeconds;
+  dr_lc_wdt_update_subseconds = lc_wdt_info.TimeOfLastUpdateSubSecs;
+
+  // DR doesn't diagnose from now until it switches to the new model,
+  // see DR_DiagnosisBlocked().
+  OS_printf("DR: DR_AdvanceModeChange(): Waiting on LC table activation...\n");
+  DR_StartModeChangeStep(DR_MODE_CHANGE_ACTIVATING_LC_WDT);
+  DR_SendLcWdtCommand(CFE_TBL_ACTIVATE_CC);
+}
+
+bool DR_LcWdtUpdated(void)
+{
+  CFE_TBL_Info_t lc_wdt_info;
+  bool updated = false;
+
+  if(CFE_SUCCESS == CFE_TBL_GetInfo(&lc_wdt_info, LC_APP_NAME"."LC_WDT_TABLENAME))
+  {
+    updated =
+      (lc_wdt_info.TimeOfLastUpdateSeconds != dr_lc_wdt_update_seconds) ||
+      (lc_wdt_info.TimeOfLastUpdateSubSecs != dr_lc_wdt_update_subseconds);
+  }
+
+  return updated;
+}
+
+void DR_SendLcWdtCommand(uint16 command_code)
+{
+
+  // Send SB commands to TBL task, to load a new LC table. There are 3
+  // commands to send to load that table:
+  //  - load the table into an inactive buffer
+  //  - verify the table
+  //  - activate the table
+  // Historical note: When I called the CFE_TBL_Load() directly, I got an error
+  // because LC still had the table locked (i.e., still held the address).
+  // This way had no errors, but there are complications. As I understand
+  // it, the TBL task signals the LC task to do the validation and activiation,
+  // so these functions are basically asynchronous. However, cFS gives
+  // an error if we attempt to activate the table before LC has finished
+  // the validation. So the activation is only sent once the validation
+  // has completed, see DR_AdvanceModeChange(). This typically takes 2
+  // sec or so, mostly waiting for LC to manage its tables.
+  // Final way, I also found the TBL command handler functions and tried
+  // calling them directly in the hopes they would be synchronous that
+  // way. (CFE_TBL_LoadCmd(), CFE_TBL_ValidateCmd(), CFE_TBL_ActivateCmd() )
+  // It didn't work, it still waited for the LC task to do the
+  // table validation and activation. I left the software bus messages
+  // in place as the mechanism because that seemed better than calling
+  // the TBL task functions directly.
+  
+  char * lc_wdt_table_name = LC_APP_NAME"."LC_WDT_TABLENAME;
+
+  switch(command_code)
+  {
+  case CFE_TBL_LOAD_CC:
+  {
+    // Send a software bus command to table services to load the new LC table  
+    CFE_TBL_LoadCmd_t table_load_cmd;
+    
+    CFE_SB_InitMsg(&table_load_cmd, CFE_TBL_CMD_MID,
+                   sizeof(CFE_TBL_LoadCmd_t), FALSE);
+    
+    CFE_SB_SetCmdCode( (CFE_SB_Msg_t *)(&table_load_cmd), CFE_TBL_LOAD_CC);
+    strncpy(table_load_cmd.Payload.LoadFilename,
+	    dr_mode_change_def.lc_wdt_tbl_filename, OS_MAX_PATH_LEN);
+    
+    CFE_SB_SendMsg((CFE_SB_Msg_t *) &table_load_cmd);
+    break;
+  }
+  case CFE_TBL_VALIDATE_CC:
+  {
+    // Send a software bus command to table services to validate the new LC table  
+    CFE_TBL_ValidateCmd_t  table_validate_cmd;
+    
+    CFE_SB_InitMsg(&table_validate_cmd, CFE_TBL_CMD_MID,
+                   sizeof(CFE_TBL_ValidateCmd_t), FALSE);
+    
+    CFE_SB_SetCmdCode( (CFE_SB_Msg_t *)(&table_validate_cmd), CFE_TBL_VALIDATE_CC);
+    table_validate_cmd.Payload.ActiveTblFlag = CFE_TBL_INACTIVE_BUFFER;
+    strncpy(table_validate_cmd.Payload.TableName, lc_wdt_table_name, CFE_TBL_MAX_FULL_NAME_LEN);
+    
+    CFE_SB_SendMsg((CFE_SB_Msg_t *) &table_validate_cmd);
+    break;
+  }
+  case CFE_TBL_ACTIVATE_CC:
+  {
+    // Send a software bus command to table services to activate the LC table
+    CFE_TBL_ActivateCmd_t  table_activate_cmd;
+    
+    CFE_SB_InitMsg(&table_activate_cmd, CFE_TBL_CMD_MID,
+                   sizeof(CFE_TBL_ActivateCmd_t), FALSE);
+    
+    CFE_SB_SetCmdCode( (CFE_SB_Msg_t *)(&table_activate_cmd), CFE_TBL_ACTIVATE_CC);
+    strncpy(table_activate_cmd.Payload.TableName, lc_wdt_table_name, CFE_TBL_MAX_FULL_NAME_LEN);
+    
+    CFE_SB_SendMsg((CFE_SB_Msg_t *) &table_activate_cmd);
+    break;
+  }
+  default:
+    break;
+  }
+
+}
+
+int32 DR_SwitchMode(void)
+{
+  // Check that it actually was the table that we wanted.
+  // It would be nice to have feedback before this point but I'm not
+  // sure how to do that.
+  int32 status = DR_CheckLcWdtFile(dr_mode_change_def.lc_wdt_tbl_filename);
+
+  // Now that LC watches the new mode's watchpoints, switch to the model
+  // loaded for them before LC was asked to activate them, and to the
+  // new mode's engine. DR hasn't diagnosed since that was asked, so
+  // every diagnosis is of one mode or the other. DR_LoadModeModel()
+  // already checked that the engine can solve the model.
+  if(CFE_SUCCESS == status)
+  {
+    DR_UseModel(dr_mode_change_model);
+    dr_diagnosis_engine = dr_mode_change_def.engine;
+    dr_mode = dr_mode_change_def.mode_index;
+    strncpy(dr_mode_lc_wdt_tbl_filename,
+	    dr_mode_change_def.lc_wdt_tbl_filename,
+	    DR_MAX_MODE_TBL_FILENAME_LENGTH);
+    dr_lc_wdt_mismatch = false;
+  }
+  
+  return status;
+  
+}
+
+int32 DR_LoadModeModel(dr_mode_def_entry_type const * entry)
+{
+  // A cached mode's model is only switched to. Otherwise the new mode's
+  // tables, loaded by the steps before, are compiled into the table
+  // model not in use. A mode whose tables don't make a good model, or a
+  // model its engine can solve, isn't changed to.
+  int32 status = CFE_SUCCESS;
+  dr_model_type const * const cached_model = DR_FindCachedModel(entry);
+
+  if(NULL != cached_model)
+  {
+    OS_printf("DR: DR_LoadModeModel(): Using the cached model.\n");
+    dr_mode_change_model = cached_model;
+  }
+  else
+  {
+    status = DR_CompileModelTables();
+    dr_mode_change_model = dr_model;
+  }
+
+  if( (CFE_SUCCESS == status) &&
+      !DR_ModelSupportsEngine(dr_mode_change_model, entry->engine) )
+  {
+    CFE_EVS_SendEvent(DR_D_MATRIX_ERR_EID, CFE_EVS_ERROR,
+		      "DR: engine %d can't solve the model of mode %ld, "
+		      "model error = %d, sparse error = %d",
+		      (int)entry->engine, (long)entry->mode_index,
+		      dr_mode_change_model->error,
+		      dr_mode_change_model->sparse_error);
+    status = DR_MODEL_ERROR;
+  }
+
+  return status;
+}
+
+#if DR_MODEL_CACHE_SIZE > 0
+int32 DR_LoadModelTables(dr_mode_def_entry_type const * entry)
+{
+  int32 status = DR_LoadTableFile(dr_d_matrix_handle,
+				  DR_APP_NAME"."DR_D_MATRIX_NAME,
+				  entry->d_matrix_tbl_filename);
+
+  if(CFE_SUCCESS == status)
+  {
+    status = DR_LoadTableFile(dr_wtm_handle, DR_APP_NAME"."DR_WTM_NAME,
+			      entry->wtm_tbl_filename);
+  }
+
+  // Even after a failed load the addresses are re-acquired, so a table
+  // that was loaded is compiled now and not switched to by a later
+  // wakeup.
+  int32 const compile_status = DR_CompileModelTables();
+
+  if(CFE_SUCCESS == status)
+  {
+    status = compile_status;
+  }
+
+  return status;
+}
+#endif
+
+int32 DR_LoadTableFile(CFE_TBL_Handle_t handle, char const * const table_name,
+		       char const * const table_file)
+{
+  // Must release loadable table pointers before making updates. A table
+  // that already has the file isn't loaded again.
+  int32 status = CFE_SUCCESS;
+
+  OS_printf("DR: DR_LoadTableFile(): Loading %s from %s\n", table_name,
+	    table_file);
+  CFE_TBL_ReleaseAddress(handle);
+  dr_table_addresses_held = false;
+
+  if(!DR_TableHasFile(table_name, table_file))
+  {
+    status = CFE_TBL_Load(handle, CFE_TBL_SRC_FILE, table_file);
+  }
+
+  return status;
+}
+
+int32 DR_CompileModelTables(void)
+{
+  // Re-acquiring the table addresses compiles the new model from them,
+  // if either was loaded, into the table model not in use, and leaves
+  // the model in use alone. Otherwise dr_model was already compiled from
+  // them.
+  OS_printf("DR: DR_CompileModelTables(): About to manage the tables.\n");
+  return DR_RefreshTables(false);
+}
+
+int32 DR_CheckLcWdtFile(char const * const lc_wdt_table_file)
+{
+  // We will compare the filename LC's watchpoint definition table was
+  // last loaded from to see if it matches the one we want.
+  char * lc_wdt_table_name = LC_APP_NAME"."LC_WDT_TABLENAME;
+  CFE_TBL_Info_t lc_wdt_info;
+  int32 status = CFE_TBL_GetInfo(&lc_wdt_info, lc_wdt_table_name);
+  
+  if(CFE_SUCCESS == status)
+  {
+    int val = strncmp(lc_wdt_table_file, lc_wdt_info.LastFileLoaded, OS_MAX_PATH_LEN);
+    if(0 == val)
+    {
+      OS_printf("DR: DR_CheckLcWdtFile(): LC WDT table ready to go!\n");
+    }
+    else
+    {
+      status = DR_WATCHPOINT_TABLE_LOAD_ERROR;
+    }
+  }
+
+  return status;
+}
+
+bool DR_TableHasFile(char const * const table_name,
+		     char const * const table_file)
+{
+  // The table was last loaded from the file, and the file's data gives
+  // the CRC of the active table, so the file hasn't been changed since
+  // and loading it again would change nothing.
+  CFE_TBL_Info_t table_info;
+  uint32 file_crc = 0;
+
+  bool const has_file =
+    (CFE_SUCCESS == CFE_TBL_GetInfo(&table_info, table_name)) &&
+    (0 == strncmp(table_file, table_info.LastFileLoaded, OS_MAX_PATH_LEN)) &&
+    (CFE_SUCCESS == DR_TableFileCrc(table_file, table_info.Size, &file_crc)) &&
+    (file_crc == table_info.Crc);
+
+  return has_file;
+}
+
+int32 DR_TableFileCrc(char const * const table_file, uint32 table_size,
+		      uint32 * crc)
+{
+  // A table file is the cFE file header, the table header and then the
+  // data, loaded at the table header's offset. Only a file holding the
+  // whole table gives the CRC table services keeps for it. The table
+  // header is big-endian whatever the processor.
+  CFE_FS_Header_t fs_header;
+  CFE_TBL_File_Hdr_t tbl_header;
+  int32 const fd = OS_open(table_file, OS_READ_ONLY, 0);
+  int32 status = (fd >= 0) ? CFE_SUCCESS : OS_ERROR;
+
+  if( (CFE_SUCCESS == status) &&
+      ( ((int32)sizeof(fs_header) != CFE_FS_ReadHeader(&fs_header, fd)) ||
+	((int32)sizeof(tbl_header) !=
+	 OS_read(fd, &tbl_header, sizeof(tbl_header))) ||
+	(0 != DR_BigEndian32(&tbl_header.Offset)) ||
+	(table_size != DR_BigEndian32(&tbl_header.NumBytes)) ) )
+  {
+    status = OS_ERROR;
+  }
+
+  *crc = 0;
+  uint32 remaining = table_size;
+  while( (CFE_SUCCESS == status) && (remaining > 0) )
+  {
+    uint32 const chunk_size = (remaining < sizeof(DR_TableFileChunk)) ?
+      remaining : sizeof(DR_TableFileChunk);
+
+    if((int32)chunk_size == OS_read(fd, DR_TableFileChunk, chunk_size))
+    {
+      *crc = CFE_ES_CalculateCRC(DR_TableFileChunk, chunk_size, *crc,
+				 CFE_ES_DEFAULT_CRC);
+      remaining -= chunk_size;
+    }
+    else
+    {
+      status = OS_ERROR;
+    }
+  }
+
+  if(fd >= 0)
+  {
+    OS_close(fd);
+  }
+
+  return status;
+}
+
+uint32 DR_BigEndian32(void const * const field)
+{
+  uint8 const * const bytes = (uint8 const *)field;
+  return ((uint32)bytes[0] << 24) | ((uint32)bytes[1] << 16) |
+    ((uint32)bytes[2] << 8) | (uint32)bytes[3];
+}
+
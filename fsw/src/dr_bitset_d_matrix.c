@@ -0,0 +1,446 @@
+
+#include "dr_bitset_d_matrix.h"
+
+#include <string.h>
+
+#include "dr_process_d_matrix.h"
+
+////////////////////////////////////////////////////////////////
+// Private function prototypes
+////////////////////////////////////////////////////////////////
+
+/// Returns true if exactly one bit is set in the intersection of the
+/// two bitsets. Stops counting as soon as a second bit is found.
+/// @param [in] a The first bitset
+/// @param [in] b The second bitset
+/// @param [in] num_words The number of words in each bitset
+static bool intersection_is_single(dr_bitset_word_type const a[],
+                                   dr_bitset_word_type const b[],
+                                   uint32_t const num_words);
+
+/// Packs the test results into pass and fail bitsets, clearing the
+/// rest of each bitset's words.
+/// @param [in] num_tests The number of tests in the test results array
+/// @param [in] test_results The given test results, already checked
+/// @param [out] passed The bitset of passing tests
+/// @param [out] failed The bitset of failing tests
+static void pack_test_results(uint32_t const num_tests,
+                              dr_test_result_type const test_results[num_tests],
+                              dr_bitset_word_type passed[],
+                              dr_bitset_word_type failed[]);
+
+/// The second pass of the solver, after the first pass has left each
+/// failure mode good, suspect or unknown. Promotes to bad each suspect
+/// implicated by a failed test that implicates no other suspect.
+/// @param [in] bitset The compiled d-matrix
+/// @param [in] failed The bitset of failing tests
+/// @param [in] suspects The bitset of suspect failure modes
+/// @param [inout] failure_modes The failure modes from the first pass
+static void find_bads(dr_bitset_d_matrix_type const * const bitset,
+                      dr_bitset_word_type const failed[],
+                      dr_bitset_word_type const suspects[],
+                      dr_failure_mode_type failure_modes[]);
+
+/// Checks that a d-matrix of the given size fits both the table format
+/// and the storage of the compiled d-matrix, and if so sets the size and
+/// clears the bitsets. Otherwise the compiled d-matrix is left empty.
+/// @param [inout] bitset The compiled d-matrix
+/// @param [in] num_tests The number of tests in the d-matrix
+/// @param [in] num_failure_modes The number of failure modes in the d-matrix
+/// @param [in] format_max_tests The most tests the table format allows
+/// @param [in] format_max_failure_modes The most failure modes the table format allows
+static dr_error_type begin_compile(dr_bitset_d_matrix_type * const bitset,
+                                   uint32_t const num_tests,
+                                   uint32_t const num_failure_modes,
+                                   uint32_t const format_max_tests,
+                                   uint32_t const format_max_failure_modes);
+
+/// Sets the entry for the given failure mode and test in both the row
+/// and the column bitsets.
+/// @param [inout] bitset The compiled d-matrix
+/// @param [in] failure_mode_index The failure mode of the entry
+/// @param [in] test_index The test of the entry
+static void set_entry(dr_bitset_d_matrix_type * const bitset,
+                      uint32_t const failure_mode_index,
+                      uint32_t const test_index);
+
+/////////////////////////////////////////////////////////////////
+// Public function definitions
+/////////////////////////////////////////////////////////////////
+
+void dr_init_bitset_d_matrix(dr_bitset_d_matrix_type * const bitset,
+                             dr_bitset_word_type * const row_storage,
+                             dr_bitset_word_type * const col_storage,
+                             uint32_t const max_tests,
+                             uint32_t const max_failure_modes)
+{
+  memset(bitset, 0, sizeof(*bitset));
+
+  bitset->max_tests = max_tests;
+  bitset->max_failure_modes = max_failure_modes;
+  bitset->rows = row_storage;
+  bitset->cols = col_storage;
+}
+
+dr_error_type dr_compile_bitset_d_matrix(dr_d_matrix_tbl_type const * const d_matrix_tbl,
+                                         dr_bitset_d_matrix_type * const bitset)
+{
+  dr_error_type error = begin_compile(bitset, d_matrix_tbl->num_tests,
+                                      d_matrix_tbl->num_failure_modes,
+                                      DR_MAX_TESTS, DR_MAX_FAILURE_MODES);
+
+  if (DR_ERROR_NO_ERROR == error)
+  {
+    for (uint32_t i = 0; i < bitset->num_failure_modes; ++i)
+    {
+      for (uint32_t j = 0; j < bitset->num_tests; ++j)
+      {
+        if (d_matrix_tbl->d_matrix[i][j])
+        {
+          set_entry(bitset, i, j);
+        }
+      }
+    }
+  }
+
+  return error;
+}
+
+dr_error_type dr_compile_packed_bitset_d_matrix(
+  dr_d_matrix_packed_tbl_type const * const d_matrix_tbl,
+  dr_bitset_d_matrix_type * const bitset)
+{
+  dr_error_type error = DR_ERROR_NO_ERROR;
+
+  if (!dr_d_matrix_packed_header_is_valid(&d_matrix_tbl->header))
+  {
+    begin_compile(bitset, 0, 0, 0, 0);
+    error = DR_ERROR_INVALID_D_MATRIX;
+  }
+  else
+  {
+    error = begin_compile(bitset, d_matrix_tbl->header.num_tests,
+                          d_matrix_tbl->header.num_failure_modes,
+                          DR_MAX_MODEL_TESTS, DR_MAX_MODEL_FAILURE_MODES);
+  }
+
+  if (DR_ERROR_NO_ERROR == error)
+  {
+    uint32_t const row_bytes = DR_D_MATRIX_PACKED_ROW_BYTES(bitset->num_tests);
+
+    // Work a byte of the packed row at a time, skipping the (usually
+    // many) bytes with no entries set.
+    for (uint32_t i = 0; i < bitset->num_failure_modes; ++i)
+    {
+      uint8_t const * const row = &(d_matrix_tbl->d_matrix[i * row_bytes]);
+
+      for (uint32_t b = 0; b < row_bytes; ++b)
+      {
+        uint32_t byte = row[b];
+        while (0 != byte)
+        {
+          uint32_t const j = (b * 8u) + dr_bitset_lowest_bit(byte);
+          byte &= byte - 1;
+
+          // Ignore any padding bits past the last test
+          if (j < bitset->num_tests)
+          {
+            set_entry(bitset, i, j);
+          }
+        }
+      }
+    }
+  }
+
+  return error;
+}
+
+dr_error_type dr_process_bitset_d_matrix(dr_bitset_d_matrix_type const * const bitset,
+                                         uint32_t const num_tests,
+                                         dr_test_result_type const test_results[num_tests],
+                                         uint32_t const num_failure_modes,
+                                         dr_failure_mode_type failure_modes[num_failure_modes])
+{
+  dr_error_type error = DR_ERROR_NO_ERROR;
+
+  // Check the number of tests and failure modes given, then the test
+  // results, in the same order as dr_process_d_matrix().
+  if (num_tests != bitset->num_tests)
+  {
+    error = DR_ERROR_WRONG_NUM_TESTS;
+  }
+  else if (num_failure_modes != bitset->num_failure_modes)
+  {
+    error = DR_ERROR_WRONG_NUM_FAILURE_MODES;
+  }
+  else
+  {
+    error = dr_check_test_results(num_tests, test_results);
+  }
+
+  if (DR_ERROR_NO_ERROR == error)
+  {
+    uint32_t const test_words = bitset->test_words;
+
+    dr_bitset_word_type passed[DR_BITSET_WORDS(DR_MAX_MODEL_TESTS)];
+    dr_bitset_word_type failed[DR_BITSET_WORDS(DR_MAX_MODEL_TESTS)];
+    dr_bitset_word_type suspects[DR_BITSET_WORDS(DR_MAX_MODEL_FAILURE_MODES)] = { 0 };
+
+    pack_test_results(num_tests, test_results, passed, failed);
+
+    // First pass. A failure mode implicated by any passing test is good,
+    // regardless of test order. Otherwise one implicated by a failing
+    // test is suspect, and one with no known tests remains unknown.
+    for (uint32_t i = 0; i < num_failure_modes; ++i)
+    {
+      if (dr_bitset_intersects(dr_bitset_row(bitset, i), passed, test_words))
+      {
+        failure_modes[i] = DR_FAILURE_MODE_GOOD;
+      }
+      else if (dr_bitset_intersects(dr_bitset_row(bitset, i), failed, test_words))
+      {
+        failure_modes[i] = DR_FAILURE_MODE_SUSPECT;
+        DR_BITSET_SET(suspects, i);
+      }
+      else
+      {
+        failure_modes[i] = DR_FAILURE_MODE_UNKNOWN;
+      }
+    }
+
+    find_bads(bitset, failed, suspects, failure_modes);
+  }
+
+  return error;
+}
+
+dr_error_type dr_process_bitset_d_matrix_batch(
+  dr_bitset_d_matrix_type const * const bitset,
+  uint32_t const num_vectors,
+  uint32_t const num_tests,
+  dr_test_result_type const test_results[num_vectors][num_tests],
+  uint32_t const num_failure_modes,
+  dr_failure_mode_type failure_modes[num_vectors][num_failure_modes])
+{
+  dr_error_type error = DR_ERROR_NO_ERROR;
+
+  // Check every vector before solving any, so that an error leaves all
+  // of the failure modes alone.
+  if (num_tests != bitset->num_tests)
+  {
+    error = DR_ERROR_WRONG_NUM_TESTS;
+  }
+  else if (num_failure_modes != bitset->num_failure_modes)
+  {
+    error = DR_ERROR_WRONG_NUM_FAILURE_MODES;
+  }
+
+  for (uint32_t v = 0; (v < num_vectors) && (DR_ERROR_NO_ERROR == error); ++v)
+  {
+    error = dr_check_test_results(num_tests, test_results[v]);
+  }
+
+  if (DR_ERROR_NO_ERROR == error)
+  {
+    uint32_t const test_words = bitset->test_words;
+    uint32_t const failure_mode_words = bitset->failure_mode_words;
+
+    dr_bitset_word_type
+      passed[DR_BITSET_BATCH_VECTORS][DR_BITSET_WORDS(DR_MAX_MODEL_TESTS)];
+    dr_bitset_word_type
+      failed[DR_BITSET_BATCH_VECTORS][DR_BITSET_WORDS(DR_MAX_MODEL_TESTS)];
+    dr_bitset_word_type
+      suspects[DR_BITSET_BATCH_VECTORS][DR_BITSET_WORDS(DR_MAX_MODEL_FAILURE_MODES)];
+
+    for (uint32_t first = 0; first < num_vectors; first += DR_BITSET_BATCH_VECTORS)
+    {
+      uint32_t const block_vectors =
+        ((num_vectors - first) < DR_BITSET_BATCH_VECTORS) ?
+        (num_vectors - first) : DR_BITSET_BATCH_VECTORS;
+
+      for (uint32_t v = 0; v < block_vectors; ++v)
+      {
+        pack_test_results(num_tests, test_results[first + v],
+                          passed[v], failed[v]);
+        memset(suspects[v], 0, sizeof(dr_bitset_word_type) * failure_mode_words);
+      }
+
+      // First pass, as in dr_process_bitset_d_matrix(), but each row is
+      // read once for the whole block of vectors rather than once per
+      // vector, so it stays in cache while the block's bitsets stream
+      // past it.
+      for (uint32_t i = 0; i < num_failure_modes; ++i)
+      {
+        dr_bitset_word_type const * const row = dr_bitset_row(bitset, i);
+
+        for (uint32_t v = 0; v < block_vectors; ++v)
+        {
+          dr_failure_mode_type * const failure_mode =
+            &(failure_modes[first + v][i]);
+
+          if (dr_bitset_intersects(row, passed[v], test_words))
+          {
+            *failure_mode = DR_FAILURE_MODE_GOOD;
+          }
+          else if (dr_bitset_intersects(row, failed[v], test_words))
+          {
+            *failure_mode = DR_FAILURE_MODE_SUSPECT;
+            DR_BITSET_SET(suspects[v], i);
+          }
+          else
+          {
+            *failure_mode = DR_FAILURE_MODE_UNKNOWN;
+          }
+        }
+      }
+
+      // The second pass only visits the failed tests and suspects of
+      // each vector, so it is done a vector at a time.
+      for (uint32_t v = 0; v < block_vectors; ++v)
+      {
+        find_bads(bitset, failed[v], suspects[v], failure_modes[first + v]);
+      }
+    }
+  }
+
+  return error;
+}
+
+////////////////////////////////////////////////////////////////
+// Private function definitions
+////////////////////////////////////////////////////////////////
+
+dr_error_type begin_compile(dr_bitset_d_matrix_type * const bitset,
+                            uint32_t const num_tests,
+                            uint32_t const num_failure_modes,
+                            uint32_t const format_max_tests,
+                            uint32_t const format_max_failure_modes)
+{
+  dr_error_type error = DR_ERROR_NO_ERROR;
+
+  if ( (num_tests > format_max_tests) ||
+       (num_tests > bitset->max_tests) )
+  {
+    error = DR_ERROR_WRONG_NUM_TESTS;
+  }
+  else if ( (num_failure_modes > format_max_failure_modes) ||
+            (num_failure_modes > bitset->max_failure_modes) )
+  {
+    error = DR_ERROR_WRONG_NUM_FAILURE_MODES;
+  }
+
+  if (DR_ERROR_NO_ERROR == error)
+  {
+    bitset->num_tests = num_tests;
+    bitset->num_failure_modes = num_failure_modes;
+  }
+  else
+  {
+    bitset->num_tests = 0;
+    bitset->num_failure_modes = 0;
+  }
+
+  bitset->test_words = DR_BITSET_WORDS(bitset->num_tests);
+  bitset->failure_mode_words = DR_BITSET_WORDS(bitset->num_failure_modes);
+
+  // Only the part of the storage used at this size needs clearing
+  memset(bitset->rows, 0, sizeof(dr_bitset_word_type) *
+         bitset->num_failure_modes * bitset->test_words);
+  memset(bitset->cols, 0, sizeof(dr_bitset_word_type) *
+         bitset->num_tests * bitset->failure_mode_words);
+
+  return error;
+}
+
+void pack_test_results(uint32_t const num_tests,
+                       dr_test_result_type const test_results[num_tests],
+                       dr_bitset_word_type passed[],
+                       dr_bitset_word_type failed[])
+{
+  uint32_t const num_words = DR_BITSET_WORDS(num_tests);
+  memset(passed, 0, sizeof(dr_bitset_word_type) * num_words);
+  memset(failed, 0, sizeof(dr_bitset_word_type) * num_words);
+
+  for (uint32_t j = 0; j < num_tests; ++j)
+  {
+    if (DR_TEST_RESULT_PASS == test_results[j])
+    {
+      DR_BITSET_SET(passed, j);
+    }
+    else if (DR_TEST_RESULT_FAIL == test_results[j])
+    {
+      DR_BITSET_SET(failed, j);
+    }
+  }
+}
+
+void find_bads(dr_bitset_d_matrix_type const * const bitset,
+               dr_bitset_word_type const failed[],
+               dr_bitset_word_type const suspects[],
+               dr_failure_mode_type failure_modes[])
+{
+  uint32_t const test_words = bitset->test_words;
+  uint32_t const failure_mode_words = bitset->failure_mode_words;
+
+  dr_bitset_word_type singles[DR_BITSET_WORDS(DR_MAX_MODEL_TESTS)] = { 0 };
+
+  // The set of failure modes that are suspect or bad does not change
+  // while suspects are promoted to bad, so a failed test implicates
+  // exactly one of them if and only if its column intersects the
+  // suspect set in a single bit. Find those tests once.
+  for (uint32_t w = 0; w < test_words; ++w)
+  {
+    dr_bitset_word_type word = failed[w];
+    while (0 != word)
+    {
+      uint32_t const j = (w * DR_BITSET_WORD_BITS) + dr_bitset_lowest_bit(word);
+      word &= word - 1;
+
+      if (intersection_is_single(dr_bitset_col(bitset, j), suspects,
+                                 failure_mode_words))
+      {
+        DR_BITSET_SET(singles, j);
+      }
+    }
+  }
+
+  // A suspect is bad if it is implicated by one of those tests.
+  for (uint32_t w = 0; w < failure_mode_words; ++w)
+  {
+    dr_bitset_word_type word = suspects[w];
+    while (0 != word)
+    {
+      uint32_t const i = (w * DR_BITSET_WORD_BITS) + dr_bitset_lowest_bit(word);
+      word &= word - 1;
+
+      if (dr_bitset_intersects(dr_bitset_row(bitset, i), singles, test_words))
+      {
+        failure_modes[i] = DR_FAILURE_MODE_BAD;
+      }
+    }
+  }
+}
+
+void set_entry(dr_bitset_d_matrix_type * const bitset,
+               uint32_t const failure_mode_index,
+               uint32_t const test_index)
+{
+  DR_BITSET_SET(bitset->rows + (failure_mode_index * bitset->test_words),
+                test_index);
+  DR_BITSET_SET(bitset->cols + (test_index * bitset->failure_mode_words),
+                failure_mode_index);
+}
+
+bool intersection_is_single(dr_bitset_word_type const a[],
+                            dr_bitset_word_type const b[],
+                            uint32_t const num_words)
+{
+  uint32_t count = 0;
+
+  for (uint32_t w = 0; (w < num_words) && (count < 2); ++w)
+  {
+    count += dr_bitset_popcount(a[w] & b[w]);
+  }
+
+  return (1 == count);
+}
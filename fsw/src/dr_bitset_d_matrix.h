@@ -0,0 +1,227 @@
+#ifndef DR_BITSET_D_MATRIX_H
+#define DR_BITSET_D_MATRIX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dr_types.h"
+#include "dr_d_matrix_tbl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The number of bits held in one word of a bitset.
+#define DR_BITSET_WORD_BITS 64
+
+/// The number of words needed to hold a bitset of num_bits bits.
+#define DR_BITSET_WORDS(num_bits) \
+  (((num_bits) + DR_BITSET_WORD_BITS - 1) / DR_BITSET_WORD_BITS)
+
+/// The number of test result vectors dr_process_bitset_d_matrix_batch()
+/// solves together, reading each d-matrix row once for all of them.
+#define DR_BITSET_BATCH_VECTORS 8
+
+/// The type of a single bitset word.
+typedef uint64_t dr_bitset_word_type;
+
+/// The number of words of storage needed for the row bitsets of a
+/// compiled d-matrix with up to max_tests tests and max_failure_modes
+/// failure modes.
+#define DR_BITSET_ROW_STORAGE_WORDS(max_tests, max_failure_modes) \
+  ((max_failure_modes) * DR_BITSET_WORDS(max_tests))
+
+/// The number of words of storage needed for the column bitsets of a
+/// compiled d-matrix with up to max_tests tests and max_failure_modes
+/// failure modes.
+#define DR_BITSET_COL_STORAGE_WORDS(max_tests, max_failure_modes) \
+  ((max_tests) * DR_BITSET_WORDS(max_failure_modes))
+
+/// A D-matrix compiled into bitsets, built once when the d-matrix table
+/// is loaded. Each failure mode has a row bitset of the tests that
+/// implicate it, and each test has a column bitset of the failure modes
+/// it implicates, so the solver can work on 64 cells per operation
+/// instead of one byte-sized boolean at a time.
+///
+/// The bitsets live in storage given to dr_init_bitset_d_matrix(), which
+/// fixes the largest d-matrix that may be compiled into it. They are
+/// packed at the stride of the compiled d-matrix, not the largest one.
+typedef struct
+{
+  /// The number of tests in the compiled d-matrix.
+  uint32_t num_tests;
+
+  /// The number of failure modes in the compiled d-matrix.
+  uint32_t num_failure_modes;
+
+  /// The number of words used in each row bitset (covers num_tests).
+  uint32_t test_words;
+
+  /// The number of words used in each column bitset (covers
+  /// num_failure_modes).
+  uint32_t failure_mode_words;
+
+  /// The largest number of tests the storage can hold.
+  uint32_t max_tests;
+
+  /// The largest number of failure modes the storage can hold.
+  uint32_t max_failure_modes;
+
+  /// Row i, at rows + (i * test_words), has bit j set if test j
+  /// implicates failure mode i.
+  dr_bitset_word_type * rows;
+
+  /// Column j, at cols + (j * failure_mode_words), has bit i set if
+  /// test j implicates failure mode i.
+  dr_bitset_word_type * cols;
+
+} dr_bitset_d_matrix_type;
+
+/// Returns the row bitset of the given failure mode.
+static inline dr_bitset_word_type const * dr_bitset_row(
+  dr_bitset_d_matrix_type const * const bitset,
+  uint32_t const failure_mode_index)
+{
+  return bitset->rows + (failure_mode_index * bitset->test_words);
+}
+
+/// Returns the column bitset of the given test.
+static inline dr_bitset_word_type const * dr_bitset_col(
+  dr_bitset_d_matrix_type const * const bitset,
+  uint32_t const test_index)
+{
+  return bitset->cols + (test_index * bitset->failure_mode_words);
+}
+
+/// Sets bit index in the given bitset.
+#define DR_BITSET_SET(bits, index) \
+  ((bits)[(index) / DR_BITSET_WORD_BITS] |= \
+   ((dr_bitset_word_type)1 << ((index) % DR_BITSET_WORD_BITS)))
+
+/// Clears bit index in the given bitset.
+#define DR_BITSET_CLEAR(bits, index) \
+  ((bits)[(index) / DR_BITSET_WORD_BITS] &= \
+   ~((dr_bitset_word_type)1 << ((index) % DR_BITSET_WORD_BITS)))
+
+/// Evaluates to non-zero if bit index is set in the given bitset.
+#define DR_BITSET_TEST(bits, index) \
+  (((bits)[(index) / DR_BITSET_WORD_BITS] >> \
+    ((index) % DR_BITSET_WORD_BITS)) & 1U)
+
+/// Returns the number of set bits in a word.
+static inline uint32_t dr_bitset_popcount(dr_bitset_word_type word)
+{
+#if defined(__GNUC__)
+  return (uint32_t)__builtin_popcountll(word);
+#else
+  uint32_t count = 0;
+  while (word != 0)
+  {
+    word &= word - 1;
+    ++count;
+  }
+  return count;
+#endif
+}
+
+/// Returns the index of the lowest set bit of a non-zero word.
+static inline uint32_t dr_bitset_lowest_bit(dr_bitset_word_type word)
+{
+#if defined(__GNUC__)
+  return (uint32_t)__builtin_ctzll(word);
+#else
+  uint32_t index = 0;
+  while (0 == (word & 1U))
+  {
+    word >>= 1;
+    ++index;
+  }
+  return index;
+#endif
+}
+
+/// Returns true if the two bitsets share any set bit.
+static inline bool dr_bitset_intersects(dr_bitset_word_type const a[],
+                                        dr_bitset_word_type const b[],
+                                        uint32_t const num_words)
+{
+  dr_bitset_word_type any = 0;
+  for (uint32_t w = 0; w < num_words; ++w)
+  {
+    any |= a[w] & b[w];
+  }
+  return (0 != any);
+}
+
+/// Gives storage to a compiled d-matrix, and leaves it empty.
+/// @param [out] bitset The compiled d-matrix to initialize
+/// @param [in] row_storage At least DR_BITSET_ROW_STORAGE_WORDS(max_tests, max_failure_modes) words
+/// @param [in] col_storage At least DR_BITSET_COL_STORAGE_WORDS(max_tests, max_failure_modes) words
+/// @param [in] max_tests The largest number of tests that may be compiled
+/// @param [in] max_failure_modes The largest number of failure modes that may be compiled
+void dr_init_bitset_d_matrix(dr_bitset_d_matrix_type * const bitset,
+                             dr_bitset_word_type * const row_storage,
+                             dr_bitset_word_type * const col_storage,
+                             uint32_t const max_tests,
+                             uint32_t const max_failure_modes);
+
+/// Compiles a d-matrix table into its row and column bitsets. This is
+/// meant to be called once each time the d-matrix table is loaded,
+/// not on every diagnosis. If an error is returned the compiled
+/// d-matrix is left empty.
+/// @param [in] d_matrix_tbl The d-matrix table to compile
+/// @param [inout] bitset The compiled d-matrix, already given storage
+/// @return DR_ERROR_WRONG_NUM_TESTS or DR_ERROR_WRONG_NUM_FAILURE_MODES if the table doesn't fit
+dr_error_type dr_compile_bitset_d_matrix(dr_d_matrix_tbl_type const * const d_matrix_tbl,
+                                         dr_bitset_d_matrix_type * const bitset);
+
+/// Same as dr_compile_bitset_d_matrix(), for the packed, variable-size
+/// d-matrix table.
+/// @param [in] d_matrix_tbl The packed d-matrix table to compile
+/// @param [inout] bitset The compiled d-matrix, already given storage
+/// @return DR_ERROR_INVALID_D_MATRIX if the header is not valid, or one of the errors of dr_compile_bitset_d_matrix()
+dr_error_type dr_compile_packed_bitset_d_matrix(
+  dr_d_matrix_packed_tbl_type const * const d_matrix_tbl,
+  dr_bitset_d_matrix_type * const bitset);
+
+/// Solves a compiled d-matrix for the given test results. Gives exactly
+/// the same failure modes and errors as dr_process_d_matrix() on the
+/// table the bitsets were compiled from.
+/// @param [in] bitset The compiled d-matrix to solve
+/// @param [in] num_tests  The number of tests in the test results array
+/// @param [in] test_results The given test results
+/// @param [in] num_failure_modes The number of failure modes in the failure_modes array
+/// @param [out] failure_modes The returned failure modes from processing the d-matrix
+dr_error_type dr_process_bitset_d_matrix(dr_bitset_d_matrix_type const * const bitset,
+                                         uint32_t const num_tests,
+                                         dr_test_result_type const test_results[num_tests],
+                                         uint32_t const num_failure_modes,
+                                         dr_failure_mode_type failure_modes[num_failure_modes]);
+
+/// Solves a compiled d-matrix for many test result vectors in one call,
+/// such as for replaying recorded test results or Monte Carlo studies.
+/// Each vector gives the same failure modes as dr_process_bitset_d_matrix()
+/// would, but the argument checks are done once, and the vectors are
+/// solved in blocks of DR_BITSET_BATCH_VECTORS so each d-matrix row is
+/// read once per block. The vectors are contiguous, one after another.
+/// If an error is returned none of the failure modes are changed.
+/// @param [in] bitset The compiled d-matrix to solve
+/// @param [in] num_vectors The number of test result vectors
+/// @param [in] num_tests  The number of tests in each test results vector
+/// @param [in] test_results The given test result vectors
+/// @param [in] num_failure_modes The number of failure modes in each failure modes vector
+/// @param [out] failure_modes The returned failure modes, one vector per test results vector
+dr_error_type dr_process_bitset_d_matrix_batch(
+  dr_bitset_d_matrix_type const * const bitset,
+  uint32_t const num_vectors,
+  uint32_t const num_tests,
+  dr_test_result_type const test_results[num_vectors][num_tests],
+  uint32_t const num_failure_modes,
+  dr_failure_mode_type failure_modes[num_vectors][num_failure_modes]);
+
+#ifdef __cplusplus
+} // extern "C" {
+#endif
+
+
+#endif // DR_BITSET_D_MATRIX_H
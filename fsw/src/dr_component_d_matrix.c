@@ -0,0 +1,301 @@
+
+#include "dr_component_d_matrix.h"
+
+#include <string.h>
+
+#include "dr_process_d_matrix.h"
+
+////////////////////////////////////////////////////////////////
+// Private definitions
+////////////////////////////////////////////////////////////////
+
+/// Marks a root that has no component number yet.
+#define NO_COMPONENT UINT32_MAX
+
+////////////////////////////////////////////////////////////////
+// Private function prototypes
+////////////////////////////////////////////////////////////////
+
+/// Returns the parent of a node while the components are being found.
+/// Nodes are the tests, then the failure modes, and their parents are
+/// kept in the test_component and failure_mode_component arrays until
+/// the components are numbered.
+/// @param [in] components The components being found
+/// @param [in] node The node, a test or num_tests plus a failure mode
+static dr_sparse_index_type * parent_of(dr_components_type * const components,
+                                        uint32_t const node);
+
+/// Returns the root of a node's tree, halving its path on the way.
+/// @param [inout] components The components being found
+/// @param [in] node The node to find the root of
+static uint32_t find_root(dr_components_type * const components,
+                          uint32_t node);
+
+/// Solves one component, updating the failure modes of the state.
+/// @param [in] sparse The sparse d-matrix
+/// @param [in] components The connected components of the sparse d-matrix
+/// @param [in] component The component to solve
+/// @param [inout] state The state holding the test results and failure modes
+static void solve_component(dr_sparse_d_matrix_type const * const sparse,
+                            dr_components_type const * const components,
+                            uint32_t const component,
+                            dr_component_state_type * const state);
+
+/////////////////////////////////////////////////////////////////
+// Public function definitions
+/////////////////////////////////////////////////////////////////
+
+void dr_partition_d_matrix(dr_sparse_d_matrix_type const * const sparse,
+                           dr_components_type * const components)
+{
+  uint32_t const num_tests = sparse->num_tests;
+  uint32_t const num_failure_modes = sparse->num_failure_modes;
+  uint32_t const num_nodes = num_tests + num_failure_modes;
+
+  components->num_tests = num_tests;
+  components->num_failure_modes = num_failure_modes;
+  components->num_components = 0;
+
+  // Every node starts as its own tree, then the trees of each failure
+  // mode and the tests implicating it are joined.
+  for (uint32_t n = 0; n < num_nodes; ++n)
+  {
+    *parent_of(components, n) = (dr_sparse_index_type)n;
+  }
+
+  for (uint32_t i = 0; i < num_failure_modes; ++i)
+  {
+    for (dr_sparse_offset_type k = sparse->row_starts[i];
+         k < sparse->row_starts[i + 1]; ++k)
+    {
+      uint32_t const root_1 = find_root(components, num_tests + i);
+      uint32_t const root_2 = find_root(components, sparse->row_tests[k]);
+      if (root_1 != root_2)
+      {
+        *parent_of(components, root_2) = (dr_sparse_index_type)root_1;
+      }
+    }
+  }
+
+  // Point every node straight at its root, then number the roots in
+  // order of their first test, then first failure mode. The start
+  // arrays aren't built yet, so the root numbers are kept in
+  // failure_mode_starts for now.
+  dr_sparse_offset_type * const root_component = components->failure_mode_starts;
+
+  for (uint32_t n = 0; n < num_nodes; ++n)
+  {
+    *parent_of(components, n) = (dr_sparse_index_type)find_root(components, n);
+    root_component[n] = NO_COMPONENT;
+  }
+
+  for (uint32_t n = 0; n < num_nodes; ++n)
+  {
+    uint32_t const root = *parent_of(components, n);
+    if (NO_COMPONENT == root_component[root])
+    {
+      root_component[root] = components->num_components++;
+    }
+  }
+
+  // Each node now only needs its own entry to replace its root with
+  // its component number.
+  for (uint32_t j = 0; j < num_tests; ++j)
+  {
+    components->test_component[j] =
+      (dr_sparse_index_type)root_component[components->test_component[j]];
+  }
+  for (uint32_t i = 0; i < num_failure_modes; ++i)
+  {
+    components->failure_mode_component[i] =
+      (dr_sparse_index_type)root_component[components->failure_mode_component[i]];
+  }
+
+  // Count the members of each component, and turn the counts into the
+  // start of each component's members.
+  uint32_t const num_starts = components->num_components + 1;
+  memset(components->test_starts, 0, sizeof(dr_sparse_offset_type) * num_starts);
+  memset(components->failure_mode_starts, 0,
+         sizeof(dr_sparse_offset_type) * num_starts);
+
+  for (uint32_t j = 0; j < num_tests; ++j)
+  {
+    components->test_starts[components->test_component[j] + 1]++;
+  }
+  for (uint32_t i = 0; i < num_failure_modes; ++i)
+  {
+    components->failure_mode_starts[components->failure_mode_component[i] + 1]++;
+  }
+  for (uint32_t c = 0; c < components->num_components; ++c)
+  {
+    components->test_starts[c + 1] += components->test_starts[c];
+    components->failure_mode_starts[c + 1] += components->failure_mode_starts[c];
+  }
+
+  // Fill in the members of each component, in increasing order, using
+  // the start of each component as its next free place. That leaves
+  // each start at the start of the next component, so shift them back.
+  for (uint32_t j = 0; j < num_tests; ++j)
+  {
+    components->tests[components->test_starts[components->test_component[j]]++] =
+      (dr_sparse_index_type)j;
+  }
+  for (uint32_t i = 0; i < num_failure_modes; ++i)
+  {
+    components->failure_modes[
+      components->failure_mode_starts[components->failure_mode_component[i]]++] =
+      (dr_sparse_index_type)i;
+  }
+
+  memmove(&(components->test_starts[1]), &(components->test_starts[0]),
+          sizeof(dr_sparse_offset_type) * components->num_components);
+  memmove(&(components->failure_mode_starts[1]),
+          &(components->failure_mode_starts[0]),
+          sizeof(dr_sparse_offset_type) * components->num_components);
+  components->test_starts[0] = 0;
+  components->failure_mode_starts[0] = 0;
+}
+
+void dr_reset_component_d_matrix(dr_component_state_type * const state)
+{
+  memset(state, 0, sizeof(*state));
+
+  // With every test unknown, every failure mode is unknown. Starting
+  // from there, the first diagnosis solves the components of every
+  // known test.
+  for (uint32_t j = 0; j < DR_MAX_MODEL_TESTS; ++j)
+  {
+    state->test_results[j] = DR_TEST_RESULT_UNKNOWN;
+  }
+  for (uint32_t i = 0; i < DR_MAX_MODEL_FAILURE_MODES; ++i)
+  {
+    state->failure_modes[i] = DR_FAILURE_MODE_UNKNOWN;
+  }
+}
+
+dr_error_type dr_process_component_d_matrix(
+  dr_sparse_d_matrix_type const * const sparse,
+  dr_components_type const * const components,
+  dr_component_state_type * const state,
+  uint32_t const num_tests,
+  dr_test_result_type const test_results[num_tests],
+  uint32_t const num_failure_modes,
+  dr_failure_mode_type failure_modes[num_failure_modes])
+{
+  dr_error_type error = DR_ERROR_NO_ERROR;
+
+  // Check the arguments in the same order as dr_process_d_matrix().
+  if (num_tests != sparse->num_tests)
+  {
+    error = DR_ERROR_WRONG_NUM_TESTS;
+  }
+  else if (num_failure_modes != sparse->num_failure_modes)
+  {
+    error = DR_ERROR_WRONG_NUM_FAILURE_MODES;
+  }
+  else
+  {
+    error = dr_check_test_results(num_tests, test_results);
+  }
+
+  if (DR_ERROR_NO_ERROR == error)
+  {
+    if (!state->valid)
+    {
+      dr_reset_component_d_matrix(state);
+      state->valid = true;
+    }
+
+    // Mark the components of the tests that changed
+    for (uint32_t j = 0; j < num_tests; ++j)
+    {
+      if (test_results[j] != state->test_results[j])
+      {
+        state->test_results[j] = test_results[j];
+        state->changed[components->test_component[j]] = true;
+      }
+    }
+
+    // Solve just those components. The rest keep their failure modes.
+    state->num_solved_components = 0;
+    for (uint32_t c = 0; c < components->num_components; ++c)
+    {
+      if (state->changed[c])
+      {
+        solve_component(sparse, components, c, state);
+        state->changed[c] = false;
+        state->num_solved_components++;
+      }
+    }
+
+    memcpy(failure_modes, state->failure_modes,
+           sizeof(dr_failure_mode_type) * num_failure_modes);
+  }
+
+  return error;
+}
+
+////////////////////////////////////////////////////////////////
+// Private function definitions
+////////////////////////////////////////////////////////////////
+
+dr_sparse_index_type * parent_of(dr_components_type * const components,
+                                 uint32_t const node)
+{
+  return (node < components->num_tests) ?
+    &(components->test_component[node]) :
+    &(components->failure_mode_component[node - components->num_tests]);
+}
+
+uint32_t find_root(dr_components_type * const components,
+                   uint32_t node)
+{
+  dr_sparse_index_type * parent = parent_of(components, node);
+
+  while (*parent != node)
+  {
+    dr_sparse_index_type * const grandparent = parent_of(components, *parent);
+    *parent = *grandparent;
+    node = *parent;
+    parent = parent_of(components, node);
+  }
+
+  return node;
+}
+
+void solve_component(dr_sparse_d_matrix_type const * const sparse,
+                     dr_components_type const * const components,
+                     uint32_t const component,
+                     dr_component_state_type * const state)
+{
+  dr_sparse_offset_type const fm_begin = components->failure_mode_starts[component];
+  dr_sparse_offset_type const fm_end = components->failure_mode_starts[component + 1];
+  dr_sparse_offset_type const test_begin = components->test_starts[component];
+  dr_sparse_offset_type const test_end = components->test_starts[component + 1];
+
+  // The same passes as dr_process_sparse_d_matrix(), over the members
+  // of the component only. The tests of the component implicate only
+  // its failure modes, and the reverse, so nothing outside is needed.
+  for (dr_sparse_offset_type k = fm_begin; k < fm_end; ++k)
+  {
+    uint32_t const i = components->failure_modes[k];
+    state->failure_modes[i] = dr_sparse_first_pass(sparse, i, state->test_results);
+  }
+
+  for (dr_sparse_offset_type k = test_begin; k < test_end; ++k)
+  {
+    uint32_t const j = components->tests[k];
+    state->single[j] = dr_sparse_is_single(sparse, j, state->test_results,
+                                           state->failure_modes);
+  }
+
+  for (dr_sparse_offset_type k = fm_begin; k < fm_end; ++k)
+  {
+    uint32_t const i = components->failure_modes[k];
+    if ( (DR_FAILURE_MODE_SUSPECT == state->failure_modes[i]) &&
+         dr_sparse_is_bad(sparse, i, state->single) )
+    {
+      state->failure_modes[i] = DR_FAILURE_MODE_BAD;
+    }
+  }
+}
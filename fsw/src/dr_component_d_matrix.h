@@ -0,0 +1,120 @@
+#ifndef DR_COMPONENT_D_MATRIX_H
+#define DR_COMPONENT_D_MATRIX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dr_types.h"
+#include "dr_sparse_d_matrix.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The most connected components a model can have, when no test
+/// implicates any failure mode and each is a component of its own.
+#define DR_MAX_MODEL_COMPONENTS (DR_MAX_MODEL_TESTS + DR_MAX_MODEL_FAILURE_MODES)
+
+/// The connected components of a d-matrix, seen as a bipartite graph
+/// of tests and failure modes with an edge for each entry set. Built
+/// once when the d-matrix table is loaded. No test of one component
+/// implicates a failure mode of another, so each component can be
+/// solved on its own, and only when its tests change.
+typedef struct
+{
+  /// The number of tests in the partitioned d-matrix.
+  uint32_t num_tests;
+
+  /// The number of failure modes in the partitioned d-matrix.
+  uint32_t num_failure_modes;
+
+  /// The number of connected components.
+  uint32_t num_components;
+
+  /// The component of each test.
+  dr_sparse_index_type test_component[DR_MAX_MODEL_TESTS];
+
+  /// The component of each failure mode.
+  dr_sparse_index_type failure_mode_component[DR_MAX_MODEL_FAILURE_MODES];
+
+  /// The tests of component c are tests[test_starts[c]] up to but not
+  /// including tests[test_starts[c + 1]].
+  dr_sparse_offset_type test_starts[DR_MAX_MODEL_COMPONENTS + 1];
+
+  /// The tests of each component, in increasing order.
+  dr_sparse_index_type tests[DR_MAX_MODEL_TESTS];
+
+  /// The failure modes of component c are
+  /// failure_modes[failure_mode_starts[c]] up to but not including
+  /// failure_modes[failure_mode_starts[c + 1]].
+  dr_sparse_offset_type failure_mode_starts[DR_MAX_MODEL_COMPONENTS + 1];
+
+  /// The failure modes of each component, in increasing order.
+  dr_sparse_index_type failure_modes[DR_MAX_MODEL_FAILURE_MODES];
+
+} dr_components_type;
+
+/// The state carried from one component diagnosis to the next.
+typedef struct
+{
+  /// False until the first diagnosis after a reset.
+  bool valid;
+
+  /// The number of components solved in the last diagnosis.
+  uint32_t num_solved_components;
+
+  /// The test results given to the last diagnosis.
+  dr_test_result_type test_results[DR_MAX_MODEL_TESTS];
+
+  /// The failure modes found by the last diagnosis.
+  dr_failure_mode_type failure_modes[DR_MAX_MODEL_FAILURE_MODES];
+
+  /// Whether each component has a test that changed, so must be solved.
+  bool changed[DR_MAX_MODEL_COMPONENTS];
+
+  /// Whether each test is a failed test implicating exactly one
+  /// suspect, for the components being solved.
+  bool single[DR_MAX_MODEL_TESTS];
+
+} dr_component_state_type;
+
+/// Finds the connected components of a sparse d-matrix. This is meant
+/// to be called once each time the d-matrix table is loaded, right
+/// after the sparse d-matrix is compiled.
+/// @param [in] sparse The sparse d-matrix
+/// @param [out] components The connected components found
+void dr_partition_d_matrix(dr_sparse_d_matrix_type const * const sparse,
+                           dr_components_type * const components);
+
+/// Resets the component state, so that the next diagnosis solves every
+/// component. Must be called whenever the d-matrix changes.
+/// @param [out] state The component state to reset
+void dr_reset_component_d_matrix(dr_component_state_type * const state);
+
+/// Solves a sparse d-matrix one connected component at a time, only
+/// solving the components with a test whose result changed since the
+/// previous call. The failure modes are always identical to those from
+/// dr_process_sparse_d_matrix() for the same test results. If an error
+/// is returned, neither the state nor the failure modes are changed.
+/// @param [in] sparse The sparse d-matrix to solve
+/// @param [in] components The connected components of the sparse d-matrix
+/// @param [inout] state The state left by the previous call
+/// @param [in] num_tests  The number of tests in the test results array
+/// @param [in] test_results The given test results
+/// @param [in] num_failure_modes The number of failure modes in the failure_modes array
+/// @param [out] failure_modes The returned failure modes from processing the d-matrix
+dr_error_type dr_process_component_d_matrix(
+  dr_sparse_d_matrix_type const * const sparse,
+  dr_components_type const * const components,
+  dr_component_state_type * const state,
+  uint32_t const num_tests,
+  dr_test_result_type const test_results[num_tests],
+  uint32_t const num_failure_modes,
+  dr_failure_mode_type failure_modes[num_failure_modes]);
+
+#ifdef __cplusplus
+} // extern "C" {
+#endif
+
+
+#endif // DR_COMPONENT_D_MATRIX_H
@@ -1,40 +1,115 @@
-#ifndef DR_D_MATRIX_TBL_H
-#define DR_D_MATRIX_TBL_H
-
-#include <stdbool.h>
-#include <stdint.h>
-
-#include "dr_types.h"
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/// A type to hold information for a dependency matrix (D-matrix). 
-typedef struct
-{
-  /// The actual number tests used by this D-matrix.
-  uint32_t num_tests;
-
-  /// The actual number of failure modes used by this D-matrix.
-  uint32_t num_failure_modes;
-
-  /// The D-matrix itself. A 2-D array of boolean values that maps
-  /// the test outcomes into failures. The format is shown below.
-  //                 test1   test2
-  //                ---------------
-  // failure_mode1  |  1   |  0   |
-  // failure_mode2  |  1   |  1   |
-  //                ---------------
-  // However, because the C language is column-major order, the first
-  // subscript will correspond to failure modes and the second to tests.
-  bool d_matrix[DR_MAX_FAILURE_MODES][DR_MAX_TESTS];
-
-} dr_d_matrix_tbl_type;
-
-#ifdef __cplusplus
-} // extern "C" {
-#endif
-
-
-#endif // DR_D_MATRIX_TBL_H
+#ifndef DR_D_MATRIX_TBL_H
+#define DR_D_MATRIX_TBL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dr_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// A type to hold information for a dependency matrix (D-matrix). 
+typedef struct
+{
+  /// The actual number tests used by this D-matrix.
+  uint32_t num_tests;
+
+  /// The actual number of failure modes used by this D-matrix.
+  uint32_t num_failure_modes;
+
+  /// The D-matrix itself. A 2-D array of boolean values that maps
+  /// the test outcomes into failures. The format is shown below.
+  //                 test1   test2
+  //                ---------------
+  // failure_mode1  |  1   |  0   |
+  // failure_mode2  |  1   |  1   |
+  //                ---------------
+  // However, because the C language is column-major order, the first
+  // subscript will correspond to failure modes and the second to tests.
+  bool d_matrix[DR_MAX_FAILURE_MODES][DR_MAX_TESTS];
+
+} dr_d_matrix_tbl_type;
+
+/// The value of the format field in the header of a packed d-matrix
+/// table, the ASCII characters "DRM1".
+#define DR_D_MATRIX_PACKED_FORMAT 0x44524D31u
+
+/// The number of bytes in each packed d-matrix row, for the given number
+/// of tests.
+#define DR_D_MATRIX_PACKED_ROW_BYTES(num_tests) (((num_tests) + 7u) / 8u)
+
+/// The maximum number of bytes of packed d-matrix data.
+#define DR_D_MATRIX_PACKED_MAX_BYTES \
+  (DR_D_MATRIX_PACKED_ROW_BYTES(DR_MAX_MODEL_TESTS) * DR_MAX_MODEL_FAILURE_MODES)
+
+/// The header of a packed d-matrix table, giving the size of the model.
+typedef struct
+{
+  /// Must be DR_D_MATRIX_PACKED_FORMAT.
+  uint32_t format;
+
+  /// The actual number tests used by this D-matrix, at most
+  /// DR_MAX_MODEL_TESTS.
+  uint32_t num_tests;
+
+  /// The actual number of failure modes used by this D-matrix, at most
+  /// DR_MAX_MODEL_FAILURE_MODES.
+  uint32_t num_failure_modes;
+
+  /// Unused, keeps the d-matrix data 8-byte aligned.
+  uint32_t spare;
+
+} dr_d_matrix_header_type;
+
+/// A variable-size D-matrix, packed one bit per entry. This is the
+/// d-matrix table format used by the DR app. The table is registered at
+/// its maximum size, but only the rows and columns given in the header
+/// are used, and the rows are packed at the stride for the actual
+/// number of tests:
+//
+//   d_matrix[(failure_mode * DR_D_MATRIX_PACKED_ROW_BYTES(num_tests)) +
+//            (test / 8)] bit (test % 8)
+//
+// So the example d-matrix shown above, with 2 tests, is { 0x03, 0x02 }.
+typedef struct
+{
+  /// The size and format of this D-matrix.
+  dr_d_matrix_header_type header;
+
+  /// The packed D-matrix rows, one per failure mode.
+  uint8_t d_matrix[DR_D_MATRIX_PACKED_MAX_BYTES];
+
+} dr_d_matrix_packed_tbl_type;
+
+/// Returns true if the header describes a packed d-matrix that fits in
+/// the packed table.
+static inline bool dr_d_matrix_packed_header_is_valid(
+  dr_d_matrix_header_type const * const header)
+{
+  return (DR_D_MATRIX_PACKED_FORMAT == header->format) &&
+    (header->num_tests <= DR_MAX_MODEL_TESTS) &&
+    (header->num_failure_modes <= DR_MAX_MODEL_FAILURE_MODES);
+}
+
+/// Returns the entry of a packed d-matrix for the given failure mode and
+/// test.
+static inline bool dr_d_matrix_packed_entry(
+  dr_d_matrix_packed_tbl_type const * const d_matrix_tbl,
+  uint32_t const failure_mode_index,
+  uint32_t const test_index)
+{
+  uint32_t const row_bytes =
+    DR_D_MATRIX_PACKED_ROW_BYTES(d_matrix_tbl->header.num_tests);
+  uint8_t const byte = d_matrix_tbl->d_matrix[(failure_mode_index * row_bytes) +
+                                              (test_index / 8u)];
+  return (0 != ((byte >> (test_index % 8u)) & 1u));
+}
+
+#ifdef __cplusplus
+} // extern "C" {
+#endif
+
+
+#endif // DR_D_MATRIX_TBL_H
@@ -0,0 +1,110 @@
+
+#include "dr_gather_plan.h"
+
+#include <string.h>
+
+/////////////////////////////////////////////////////////////////
+// Public function definitions
+/////////////////////////////////////////////////////////////////
+
+void dr_compile_gather_plan(dr_gather_plan_type * const plan,
+			    uint32_t const num_entries,
+			    dr_wtm_entry_type const wtm[num_entries])
+{
+  // First mark, in the plan's watchpoint storage, every watchpoint an
+  // active test reads, then give the marked ones slots in increasing
+  // order, so the gather reads each watchpoint once and walks the
+  // watchpoint results table forwards. A slot is never after the mark
+  // it comes from, so the marks are compacted in place.
+  uint32_t * const used = plan->watchpoints;
+  memset(used, 0, sizeof(used[0]) * plan->max_watchpoints);
+
+  for (uint32_t i = 0; i < num_entries; ++i)
+  {
+    if (wtm[i].test_active)
+    {
+      used[wtm[i].watchpoint_index] = 1;
+      if (wtm[i].test_valid_watchpoint_index != UINT32_MAX)
+      {
+	used[wtm[i].test_valid_watchpoint_index] = 1;
+      }
+      if (wtm[i].test_latching)
+      {
+	for (uint32_t k = 0; k < wtm[i].latch_clear.latch_clear_count; ++k)
+	{
+	  used[wtm[i].latch_clear.latch_clear_indices[k]] = 1;
+	}
+      }
+    }
+  }
+
+  plan->num_slots = 0;
+  for (uint32_t w = 0; w < plan->max_watchpoints; ++w)
+  {
+    if (used[w])
+    {
+      plan->watchpoints[plan->num_slots++] = w;
+    }
+  }
+
+  // Then describe each active test by its slots. A latching test
+  // without latch clear watchpoints evaluates just like a plain one.
+  uint32_t num_clear_slots = 0;
+  plan->num_tests = 0;
+
+  for (uint32_t i = 0; i < num_entries; ++i)
+  {
+    if (wtm[i].test_active)
+    {
+      dr_gather_test_type * const test = &plan->tests[plan->num_tests++];
+
+      test->test_index = (uint16_t)wtm[i].test_index;
+      test->entry_index = (uint16_t)i;
+      test->value_slot = dr_find_gather_slot(plan, wtm[i].watchpoint_index);
+      test->valid_slot = DR_GATHER_NO_SLOT;
+      if (wtm[i].test_valid_watchpoint_index != UINT32_MAX)
+      {
+	test->valid_slot =
+	  dr_find_gather_slot(plan, wtm[i].test_valid_watchpoint_index);
+      }
+      test->first_clear = (uint16_t)num_clear_slots;
+      test->num_clears = 0;
+      if (wtm[i].test_latching)
+      {
+	test->num_clears = (uint8_t)wtm[i].latch_clear.latch_clear_count;
+	for (uint32_t k = 0; k < test->num_clears; ++k)
+	{
+	  plan->clear_slots[num_clear_slots++] =
+	    dr_find_gather_slot(plan, wtm[i].latch_clear.latch_clear_indices[k]);
+	}
+      }
+      test->test_type = (uint8_t)wtm[i].test_type;
+    }
+  }
+}
+
+dr_gather_slot_type dr_find_gather_slot(dr_gather_plan_type const * const plan,
+					uint32_t const watchpoint_index)
+{
+  // Binary search of the plan's watchpoints for the first one not less
+  // than the index
+  uint32_t low = 0;
+  uint32_t high = plan->num_slots;
+
+  while (low < high)
+  {
+    uint32_t const middle = low + ((high - low) / 2);
+    if (plan->watchpoints[middle] < watchpoint_index)
+    {
+      low = middle + 1;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+
+  return ( (low < plan->num_slots) &&
+	   (plan->watchpoints[low] == watchpoint_index) ) ?
+    (dr_gather_slot_type)low : DR_GATHER_NO_SLOT;
+}
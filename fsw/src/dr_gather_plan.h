@@ -0,0 +1,96 @@
+#ifndef DR_GATHER_PLAN_H
+#define DR_GATHER_PLAN_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dr_types.h"
+#include "dr_wtm_tbl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////////////////////////////////////
+// Public Types
+////////////////////////////////////////////////////////////////////////
+
+/// A slot of the gather buffer, which holds the watch result of one
+/// watchpoint of the gather plan.
+typedef uint16_t dr_gather_slot_type;
+
+/// The slot of a test that has no validity watchpoint, and of a
+/// watchpoint that isn't in the plan.
+#define DR_GATHER_NO_SLOT UINT16_MAX
+
+/// How one active test is evaluated from the gather buffer.
+typedef struct
+{
+  /// The test result to set
+  uint16_t test_index;
+  /// The watchpoint to test mapping entry, whose previous test result
+  /// latches a latching test
+  uint16_t entry_index;
+  /// The slot of the watchpoint giving the test result
+  dr_gather_slot_type value_slot;
+  /// The slot of the watchpoint saying if the test is valid, or
+  /// DR_GATHER_NO_SLOT if it always is
+  dr_gather_slot_type valid_slot;
+  /// The first of the test's latch clear slots in the plan's clear_slots
+  uint16_t first_clear;
+  /// The number of latch clear slots, 0 unless the test is latching
+  uint8_t num_clears;
+  /// The dr_test_type_type of the test
+  uint8_t test_type;
+} dr_gather_test_type;
+
+/// The watchpoint to test mapping compiled for the gather: the
+/// watchpoints the tests read, each once and in increasing order, and for
+/// each active test the slots of the gathered watch results it uses.
+/// Built once each time the mapping is loaded.
+typedef struct
+{
+  /// The number of watchpoints in the LC watchpoint results table, less
+  /// than DR_GATHER_NO_SLOT
+  uint32_t max_watchpoints;
+  /// The number of watchpoints read, and of slots in the gather buffer
+  uint32_t num_slots;
+  /// The watchpoint of each slot, in increasing order. max_watchpoints
+  /// entries of storage.
+  uint32_t * watchpoints;
+  /// The number of active tests
+  uint32_t num_tests;
+  /// The active tests, in mapping entry order. DR_MAX_MODEL_TESTS
+  /// entries of storage.
+  dr_gather_test_type * tests;
+  /// The latch clear slots of all the tests. DR_MAX_MODEL_TESTS *
+  /// DR_MAX_CLEAR_CONDS entries of storage.
+  dr_gather_slot_type * clear_slots;
+} dr_gather_plan_type;
+
+////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////
+
+/// Builds the gather plan of the watchpoint to test mapping entries,
+/// which must already be checked by dr_validate_wtm_tbl().
+/// @param [inout] plan The plan, already given storage and max_watchpoints
+/// @param [in] num_entries The number of mapping entries, the model's tests
+/// @param [in] wtm The watchpoint to test mapping entries
+void dr_compile_gather_plan(dr_gather_plan_type * const plan,
+			    uint32_t const num_entries,
+			    dr_wtm_entry_type const wtm[num_entries]);
+
+/// Finds the gather buffer slot of a watchpoint.
+/// @param [in] plan The compiled plan
+/// @param [in] watchpoint_index The watchpoint to find
+/// @return The slot, or DR_GATHER_NO_SLOT if the plan doesn't read the
+/// watchpoint
+dr_gather_slot_type dr_find_gather_slot(dr_gather_plan_type const * const plan,
+					uint32_t const watchpoint_index);
+
+#ifdef __cplusplus
+} // extern "C" {
+#endif
+
+#endif // DR_GATHER_PLAN_H
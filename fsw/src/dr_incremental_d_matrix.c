@@ -0,0 +1,279 @@
+
+#include "dr_incremental_d_matrix.h"
+
+#include <string.h>
+
+#include "dr_process_d_matrix.h"
+
+////////////////////////////////////////////////////////////////
+// Private function prototypes
+////////////////////////////////////////////////////////////////
+
+/// Returns the good, suspect, or unknown value of a failure mode from
+/// the first pass, given the tests that passed and failed.
+/// @param [in] bitset The compiled d-matrix
+/// @param [in] failure_mode_index The failure mode to evaluate
+/// @param [in] state The state holding the passed and failed tests
+static dr_failure_mode_type evaluate_first_pass(
+  dr_bitset_d_matrix_type const * const bitset,
+  uint32_t const failure_mode_index,
+  dr_incremental_state_type const * const state);
+
+/// Returns true if the given test failed and implicates exactly one
+/// failure mode of the current suspect set.
+/// @param [in] bitset The compiled d-matrix
+/// @param [in] test_index The test to evaluate
+/// @param [in] state The state holding the failed tests and suspects
+static bool is_single_implication(
+  dr_bitset_d_matrix_type const * const bitset,
+  uint32_t const test_index,
+  dr_incremental_state_type const * const state);
+
+/////////////////////////////////////////////////////////////////
+// Public function definitions
+/////////////////////////////////////////////////////////////////
+
+void dr_reset_incremental_d_matrix(dr_incremental_state_type * const state)
+{
+  memset(state, 0, sizeof(*state));
+
+  // With every test unknown, every failure mode is unknown. Starting
+  // from there, the first diagnosis sees every known test as changed.
+  for (uint32_t j = 0; j < DR_MAX_MODEL_TESTS; ++j)
+  {
+    state->test_results[j] = DR_TEST_RESULT_UNKNOWN;
+  }
+  for (uint32_t i = 0; i < DR_MAX_MODEL_FAILURE_MODES; ++i)
+  {
+    state->failure_modes[i] = DR_FAILURE_MODE_UNKNOWN;
+  }
+}
+
+dr_error_type dr_process_incremental_d_matrix(
+  dr_bitset_d_matrix_type const * const bitset,
+  dr_incremental_state_type * const state,
+  uint32_t const num_tests,
+  dr_test_result_type const test_results[num_tests],
+  uint32_t const num_failure_modes,
+  dr_failure_mode_type failure_modes[num_failure_modes])
+{
+  dr_error_type error = DR_ERROR_NO_ERROR;
+
+  // Check the arguments in the same order as dr_process_d_matrix().
+  if (num_tests != bitset->num_tests)
+  {
+    error = DR_ERROR_WRONG_NUM_TESTS;
+  }
+  else if (num_failure_modes != bitset->num_failure_modes)
+  {
+    error = DR_ERROR_WRONG_NUM_FAILURE_MODES;
+  }
+  else
+  {
+    error = dr_check_test_results(num_tests, test_results);
+  }
+
+  if (DR_ERROR_NO_ERROR == error)
+  {
+    uint32_t const test_words = bitset->test_words;
+    uint32_t const failure_mode_words = bitset->failure_mode_words;
+
+    if (!state->valid)
+    {
+      dr_reset_incremental_d_matrix(state);
+      state->valid = true;
+    }
+
+    // Find the tests that changed since the last diagnosis, and update
+    // the passed and failed tests to match.
+    dr_bitset_word_type changed_tests[DR_BITSET_WORDS(DR_MAX_MODEL_TESTS)] = { 0 };
+    state->num_changed_tests = 0;
+
+    for (uint32_t j = 0; j < num_tests; ++j)
+    {
+      if (test_results[j] != state->test_results[j])
+      {
+        DR_BITSET_SET(changed_tests, j);
+        state->num_changed_tests++;
+
+        DR_BITSET_CLEAR(state->passed, j);
+        DR_BITSET_CLEAR(state->failed, j);
+        if (DR_TEST_RESULT_PASS == test_results[j])
+        {
+          DR_BITSET_SET(state->passed, j);
+        }
+        else if (DR_TEST_RESULT_FAIL == test_results[j])
+        {
+          DR_BITSET_SET(state->failed, j);
+        }
+
+        state->test_results[j] = test_results[j];
+      }
+    }
+
+    if (0 != state->num_changed_tests)
+    {
+      // The failure modes implicated by a changed test are the only
+      // ones whose first pass value can change.
+      dr_bitset_word_type reached[DR_BITSET_WORDS(DR_MAX_MODEL_FAILURE_MODES)] = { 0 };
+
+      for (uint32_t w = 0; w < test_words; ++w)
+      {
+        dr_bitset_word_type word = changed_tests[w];
+        while (0 != word)
+        {
+          uint32_t const j = (w * DR_BITSET_WORD_BITS) + dr_bitset_lowest_bit(word);
+          word &= word - 1;
+
+          for (uint32_t v = 0; v < failure_mode_words; ++v)
+          {
+            reached[v] |= dr_bitset_col(bitset, j)[v];
+          }
+        }
+      }
+
+      // Redo the first pass for those failure modes. Where one enters
+      // or leaves the suspect set, the single implication of each failed
+      // test that implicates it may change, so collect those tests along
+      // with the changed tests themselves.
+      dr_bitset_word_type affected_tests[DR_BITSET_WORDS(DR_MAX_MODEL_TESTS)];
+      memcpy(affected_tests, changed_tests, sizeof(affected_tests));
+
+      for (uint32_t w = 0; w < failure_mode_words; ++w)
+      {
+        dr_bitset_word_type word = reached[w];
+        while (0 != word)
+        {
+          uint32_t const i = (w * DR_BITSET_WORD_BITS) + dr_bitset_lowest_bit(word);
+          word &= word - 1;
+
+          dr_failure_mode_type const value = evaluate_first_pass(bitset, i, state);
+          bool const was_suspect = DR_BITSET_TEST(state->suspects, i);
+          bool const is_suspect = (DR_FAILURE_MODE_SUSPECT == value);
+
+          state->failure_modes[i] = value;
+
+          if (was_suspect != is_suspect)
+          {
+            if (is_suspect)
+            {
+              DR_BITSET_SET(state->suspects, i);
+            }
+            else
+            {
+              DR_BITSET_CLEAR(state->suspects, i);
+            }
+
+            for (uint32_t v = 0; v < test_words; ++v)
+            {
+              affected_tests[v] |= dr_bitset_row(bitset, i)[v];
+            }
+          }
+        }
+      }
+
+      // Update the single implications of the affected tests. The
+      // failure modes of any test whose single implication changed may
+      // change between suspect and bad, so add them to the reached set.
+      for (uint32_t w = 0; w < test_words; ++w)
+      {
+        dr_bitset_word_type word = affected_tests[w];
+        while (0 != word)
+        {
+          uint32_t const j = (w * DR_BITSET_WORD_BITS) + dr_bitset_lowest_bit(word);
+          word &= word - 1;
+
+          bool const was_single = DR_BITSET_TEST(state->singles, j);
+          bool const is_single = is_single_implication(bitset, j, state);
+
+          if (was_single != is_single)
+          {
+            if (is_single)
+            {
+              DR_BITSET_SET(state->singles, j);
+            }
+            else
+            {
+              DR_BITSET_CLEAR(state->singles, j);
+            }
+
+            for (uint32_t v = 0; v < failure_mode_words; ++v)
+            {
+              reached[v] |= dr_bitset_col(bitset, j)[v];
+            }
+          }
+        }
+      }
+
+      // Finally redo the bad pass for the reached suspects. Every other
+      // failure mode keeps its first pass value and the same single
+      // implications as last time, so its value is unchanged.
+      for (uint32_t w = 0; w < failure_mode_words; ++w)
+      {
+        dr_bitset_word_type word = reached[w] & state->suspects[w];
+        while (0 != word)
+        {
+          uint32_t const i = (w * DR_BITSET_WORD_BITS) + dr_bitset_lowest_bit(word);
+          word &= word - 1;
+
+          if (dr_bitset_intersects(dr_bitset_row(bitset, i), state->singles, test_words))
+          {
+            state->failure_modes[i] = DR_FAILURE_MODE_BAD;
+          }
+          else
+          {
+            state->failure_modes[i] = DR_FAILURE_MODE_SUSPECT;
+          }
+        }
+      }
+    }
+
+    memcpy(failure_modes, state->failure_modes,
+           sizeof(dr_failure_mode_type) * num_failure_modes);
+  }
+
+  return error;
+}
+
+////////////////////////////////////////////////////////////////
+// Private function definitions
+////////////////////////////////////////////////////////////////
+
+dr_failure_mode_type evaluate_first_pass(
+  dr_bitset_d_matrix_type const * const bitset,
+  uint32_t const failure_mode_index,
+  dr_incremental_state_type const * const state)
+{
+  dr_failure_mode_type value = DR_FAILURE_MODE_UNKNOWN;
+
+  if (dr_bitset_intersects(dr_bitset_row(bitset, failure_mode_index), state->passed,
+                           bitset->test_words))
+  {
+    value = DR_FAILURE_MODE_GOOD;
+  }
+  else if (dr_bitset_intersects(dr_bitset_row(bitset, failure_mode_index),
+                                state->failed, bitset->test_words))
+  {
+    value = DR_FAILURE_MODE_SUSPECT;
+  }
+
+  return value;
+}
+
+bool is_single_implication(dr_bitset_d_matrix_type const * const bitset,
+                           uint32_t const test_index,
+                           dr_incremental_state_type const * const state)
+{
+  uint32_t count = 0;
+
+  if (DR_BITSET_TEST(state->failed, test_index))
+  {
+    for (uint32_t w = 0; (w < bitset->failure_mode_words) && (count < 2); ++w)
+    {
+      count += dr_bitset_popcount(dr_bitset_col(bitset, test_index)[w] &
+                                  state->suspects[w]);
+    }
+  }
+
+  return (1 == count);
+}
@@ -0,0 +1,78 @@
+#ifndef DR_INCREMENTAL_D_MATRIX_H
+#define DR_INCREMENTAL_D_MATRIX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dr_types.h"
+#include "dr_bitset_d_matrix.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The state carried from one incremental diagnosis to the next. It
+/// holds the previous test results and failure modes, plus the bitsets
+/// the solver derived from them, so that the next diagnosis only has to
+/// revisit the failure modes affected by the tests that changed.
+typedef struct
+{
+  /// False until the first diagnosis after a reset. The first diagnosis
+  /// treats every known test result as changed, which is a full solve.
+  bool valid;
+
+  /// The number of tests whose results changed in the last diagnosis.
+  uint32_t num_changed_tests;
+
+  /// The test results given to the last diagnosis.
+  dr_test_result_type test_results[DR_MAX_MODEL_TESTS];
+
+  /// The failure modes found by the last diagnosis.
+  dr_failure_mode_type failure_modes[DR_MAX_MODEL_FAILURE_MODES];
+
+  /// The tests that passed in the last diagnosis.
+  dr_bitset_word_type passed[DR_BITSET_WORDS(DR_MAX_MODEL_TESTS)];
+
+  /// The tests that failed in the last diagnosis.
+  dr_bitset_word_type failed[DR_BITSET_WORDS(DR_MAX_MODEL_TESTS)];
+
+  /// The failed tests that implicated exactly one suspect or bad
+  /// failure mode in the last diagnosis.
+  dr_bitset_word_type singles[DR_BITSET_WORDS(DR_MAX_MODEL_TESTS)];
+
+  /// The failure modes that were suspect or bad in the last diagnosis.
+  dr_bitset_word_type suspects[DR_BITSET_WORDS(DR_MAX_MODEL_FAILURE_MODES)];
+
+} dr_incremental_state_type;
+
+/// Resets the incremental state, so that the next diagnosis solves the
+/// whole d-matrix. Must be called whenever the compiled d-matrix changes.
+/// @param [out] state The incremental state to reset
+void dr_reset_incremental_d_matrix(dr_incremental_state_type * const state);
+
+/// Solves a compiled d-matrix for the given test results, starting from
+/// the results of the previous call. Only the failure modes implicated by
+/// tests whose results changed, and those sharing a failed test with
+/// them, are recomputed. The failure modes are always identical to those
+/// from dr_process_bitset_d_matrix() for the same test results. If an
+/// error is returned, neither the state nor the failure modes are changed.
+/// @param [in] bitset The compiled d-matrix to solve
+/// @param [inout] state The state left by the previous call
+/// @param [in] num_tests  The number of tests in the test results array
+/// @param [in] test_results The given test results
+/// @param [in] num_failure_modes The number of failure modes in the failure_modes array
+/// @param [out] failure_modes The returned failure modes from processing the d-matrix
+dr_error_type dr_process_incremental_d_matrix(
+  dr_bitset_d_matrix_type const * const bitset,
+  dr_incremental_state_type * const state,
+  uint32_t const num_tests,
+  dr_test_result_type const test_results[num_tests],
+  uint32_t const num_failure_modes,
+  dr_failure_mode_type failure_modes[num_failure_modes]);
+
+#ifdef __cplusplus
+} // extern "C" {
+#endif
+
+
+#endif // DR_INCREMENTAL_D_MATRIX_H
@@ -0,0 +1,265 @@
+
+#include "dr_kernels.h"
+
+#include <string.h>
+
+////////////////////////////////////////////////////////////////
+// Private definitions
+////////////////////////////////////////////////////////////////
+
+// The x86 kernels need GCC (or Clang) for the target attributes and
+// __builtin_cpu_supports(). Elsewhere only the scalar kernel is built.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DR_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+////////////////////////////////////////////////////////////////
+// Private function prototypes
+////////////////////////////////////////////////////////////////
+
+/// The portable first pass kernel, also used for the tails of the
+/// vector kernels.
+static void first_pass_scalar(uint32_t const num_failure_modes,
+                              uint8_t const implicated[],
+                              dr_test_result_type const test_result,
+                              uint8_t state[]);
+
+#ifdef DR_KERNELS_X86
+/// The SSE2 first pass kernel.
+static void first_pass_sse2(uint32_t const num_failure_modes,
+                            uint8_t const implicated[],
+                            dr_test_result_type const test_result,
+                            uint8_t state[]);
+
+/// The AVX2 first pass kernel.
+static void first_pass_avx2(uint32_t const num_failure_modes,
+                            uint8_t const implicated[],
+                            dr_test_result_type const test_result,
+                            uint8_t state[]);
+#endif
+
+/////////////////////////////////////////////////////////////////
+// Public function definitions
+/////////////////////////////////////////////////////////////////
+
+bool dr_kernel_is_supported(dr_kernel_isa_type const isa)
+{
+  bool is_supported = false;
+
+  switch (isa)
+  {
+    case DR_KERNEL_SCALAR:
+      is_supported = true;
+      break;
+#ifdef DR_KERNELS_X86
+    case DR_KERNEL_SSE2:
+      is_supported = __builtin_cpu_supports("sse2");
+      break;
+    case DR_KERNEL_AVX2:
+      is_supported = __builtin_cpu_supports("avx2");
+      break;
+#else
+    case DR_KERNEL_SSE2:
+    case DR_KERNEL_AVX2:
+#endif
+    case DR_KERNEL_COUNT:
+    default:
+      break;
+  }
+
+  return is_supported;
+}
+
+dr_first_pass_kernel_type dr_get_first_pass_kernel(dr_kernel_isa_type const isa)
+{
+  dr_first_pass_kernel_type kernel = NULL;
+
+  if (dr_kernel_is_supported(isa))
+  {
+    switch (isa)
+    {
+      case DR_KERNEL_SCALAR:
+        kernel = first_pass_scalar;
+        break;
+#ifdef DR_KERNELS_X86
+      case DR_KERNEL_SSE2:
+        kernel = first_pass_sse2;
+        break;
+      case DR_KERNEL_AVX2:
+        kernel = first_pass_avx2;
+        break;
+#else
+      case DR_KERNEL_SSE2:
+      case DR_KERNEL_AVX2:
+#endif
+      case DR_KERNEL_COUNT:
+      default:
+        break;
+    }
+  }
+
+  return kernel;
+}
+
+dr_kernel_isa_type dr_select_kernel_isa(void)
+{
+  static dr_kernel_isa_type selected = DR_KERNEL_COUNT;
+
+  if (DR_KERNEL_COUNT == selected)
+  {
+    // The instruction sets are in order of speed, so take the last one
+    // that is supported.
+    dr_kernel_isa_type best = DR_KERNEL_SCALAR;
+    for (int isa = DR_KERNEL_SCALAR; isa < DR_KERNEL_COUNT; ++isa)
+    {
+      if (dr_kernel_is_supported((dr_kernel_isa_type)isa))
+      {
+        best = (dr_kernel_isa_type)isa;
+      }
+    }
+    selected = best;
+  }
+
+  return selected;
+}
+
+void dr_kernel_first_pass(uint32_t const num_tests,
+                          dr_test_result_type const test_results[num_tests],
+                          uint32_t const num_failure_modes,
+                          uint8_t const columns[],
+                          uint32_t const column_stride,
+                          uint8_t state[num_failure_modes])
+{
+  dr_first_pass_kernel_type const kernel =
+    dr_get_first_pass_kernel(dr_select_kernel_isa());
+
+  memset(state, DR_FAILURE_MODE_UNKNOWN, num_failure_modes);
+
+  for (uint32_t j = 0; j < num_tests; ++j)
+  {
+    if (DR_TEST_RESULT_UNKNOWN != test_results[j])
+    {
+      kernel(num_failure_modes, &(columns[j * column_stride]),
+             test_results[j], state);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////
+// Private function definitions
+////////////////////////////////////////////////////////////////
+
+void first_pass_scalar(uint32_t const num_failure_modes,
+                       uint8_t const implicated[],
+                       dr_test_result_type const test_result,
+                       uint8_t state[])
+{
+  if (DR_TEST_RESULT_PASS == test_result)
+  {
+    for (uint32_t i = 0; i < num_failure_modes; ++i)
+    {
+      if (0 != implicated[i])
+      {
+        state[i] = DR_FAILURE_MODE_GOOD;
+      }
+    }
+  }
+  else if (DR_TEST_RESULT_FAIL == test_result)
+  {
+    for (uint32_t i = 0; i < num_failure_modes; ++i)
+    {
+      if ( (0 != implicated[i]) && (DR_FAILURE_MODE_GOOD != state[i]) )
+      {
+        state[i] = DR_FAILURE_MODE_SUSPECT;
+      }
+    }
+  }
+}
+
+#ifdef DR_KERNELS_X86
+
+__attribute__((target("sse2")))
+void first_pass_sse2(uint32_t const num_failure_modes,
+                     uint8_t const implicated[],
+                     dr_test_result_type const test_result,
+                     uint8_t state[])
+{
+  __m128i const zero = _mm_setzero_si128();
+  __m128i const good = _mm_set1_epi8(DR_FAILURE_MODE_GOOD);
+  __m128i const suspect = _mm_set1_epi8(DR_FAILURE_MODE_SUSPECT);
+  uint32_t i = 0;
+
+  // Each step builds a mask of the failure modes to change, then blends
+  // the new value in under the mask: (state & ~mask) | (value & mask).
+  if (DR_TEST_RESULT_PASS == test_result)
+  {
+    for (; (i + 16) <= num_failure_modes; i += 16)
+    {
+      __m128i const column = _mm_loadu_si128((__m128i const *)&(implicated[i]));
+      __m128i const values = _mm_loadu_si128((__m128i const *)&(state[i]));
+      __m128i const not_implicated = _mm_cmpeq_epi8(column, zero);
+      __m128i const updated = _mm_or_si128(_mm_and_si128(not_implicated, values),
+                                           _mm_andnot_si128(not_implicated, good));
+      _mm_storeu_si128((__m128i *)&(state[i]), updated);
+    }
+  }
+  else if (DR_TEST_RESULT_FAIL == test_result)
+  {
+    for (; (i + 16) <= num_failure_modes; i += 16)
+    {
+      __m128i const column = _mm_loadu_si128((__m128i const *)&(implicated[i]));
+      __m128i const values = _mm_loadu_si128((__m128i const *)&(state[i]));
+      __m128i const keep = _mm_or_si128(_mm_cmpeq_epi8(column, zero),
+                                        _mm_cmpeq_epi8(values, good));
+      __m128i const updated = _mm_or_si128(_mm_and_si128(keep, values),
+                                           _mm_andnot_si128(keep, suspect));
+      _mm_storeu_si128((__m128i *)&(state[i]), updated);
+    }
+  }
+
+  first_pass_scalar(num_failure_modes - i, &(implicated[i]), test_result,
+                    &(state[i]));
+}
+
+__attribute__((target("avx2")))
+void first_pass_avx2(uint32_t const num_failure_modes,
+                     uint8_t const implicated[],
+                     dr_test_result_type const test_result,
+                     uint8_t state[])
+{
+  __m256i const zero = _mm256_setzero_si256();
+  __m256i const good = _mm256_set1_epi8(DR_FAILURE_MODE_GOOD);
+  __m256i const suspect = _mm256_set1_epi8(DR_FAILURE_MODE_SUSPECT);
+  uint32_t i = 0;
+
+  // As the SSE2 kernel, with a byte blend instead of and/andnot/or.
+  if (DR_TEST_RESULT_PASS == test_result)
+  {
+    for (; (i + 32) <= num_failure_modes; i += 32)
+    {
+      __m256i const column = _mm256_loadu_si256((__m256i const *)&(implicated[i]));
+      __m256i const values = _mm256_loadu_si256((__m256i const *)&(state[i]));
+      __m256i const not_implicated = _mm256_cmpeq_epi8(column, zero);
+      _mm256_storeu_si256((__m256i *)&(state[i]),
+                          _mm256_blendv_epi8(good, values, not_implicated));
+    }
+  }
+  else if (DR_TEST_RESULT_FAIL == test_result)
+  {
+    for (; (i + 32) <= num_failure_modes; i += 32)
+    {
+      __m256i const column = _mm256_loadu_si256((__m256i const *)&(implicated[i]));
+      __m256i const values = _mm256_loadu_si256((__m256i const *)&(state[i]));
+      __m256i const keep = _mm256_or_si256(_mm256_cmpeq_epi8(column, zero),
+                                           _mm256_cmpeq_epi8(values, good));
+      _mm256_storeu_si256((__m256i *)&(state[i]),
+                          _mm256_blendv_epi8(suspect, values, keep));
+    }
+  }
+
+  first_pass_scalar(num_failure_modes - i, &(implicated[i]), test_result,
+                    &(state[i]));
+}
+
+#endif // DR_KERNELS_X86
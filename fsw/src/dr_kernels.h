@@ -0,0 +1,77 @@
+#ifndef DR_KERNELS_H
+#define DR_KERNELS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dr_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The instruction sets the d-matrix kernels are written for.
+typedef enum
+{
+  /// Portable C, always available
+  DR_KERNEL_SCALAR = 0,
+  /// x86 SSE2, 16 failure modes per instruction
+  DR_KERNEL_SSE2,
+  /// x86 AVX2, 32 failure modes per instruction
+  DR_KERNEL_AVX2,
+  /// The number of kernel instruction sets
+  DR_KERNEL_COUNT
+} dr_kernel_isa_type;
+
+/// A kernel for one test of the first pass of the d-matrix solver, over
+/// a byte-packed failure mode state vector. Each byte of the state holds
+/// a dr_failure_mode_type value, and each byte of the implicated column
+/// is non-zero if the test implicates that failure mode. A passing test
+/// makes the failure modes it implicates good, and a failing test makes
+/// those not already good suspect. Unknown test results change nothing.
+/// @param [in] num_failure_modes The number of failure modes in the state
+/// @param [in] implicated The test's d-matrix column, one byte per failure mode
+/// @param [in] test_result The result of the test
+/// @param [inout] state The failure mode state vector
+typedef void (*dr_first_pass_kernel_type)(uint32_t const num_failure_modes,
+                                          uint8_t const implicated[],
+                                          dr_test_result_type const test_result,
+                                          uint8_t state[]);
+
+/// Returns true if the kernels of the given instruction set can run on
+/// this processor, checked at run time.
+/// @param [in] isa The instruction set
+bool dr_kernel_is_supported(dr_kernel_isa_type const isa);
+
+/// Returns the first pass kernel of the given instruction set, or NULL
+/// if it isn't supported by this build or this processor.
+/// @param [in] isa The instruction set
+dr_first_pass_kernel_type dr_get_first_pass_kernel(dr_kernel_isa_type const isa);
+
+/// Returns the instruction set of the fastest kernels that can run on
+/// this processor. Found on the first call and kept after that.
+dr_kernel_isa_type dr_select_kernel_isa(void);
+
+/// The first pass of the d-matrix solver over d-matrix columns laid out
+/// one after another, using the kernel of dr_select_kernel_isa(). Leaves
+/// each failure mode good, suspect or unknown, exactly as the first pass
+/// of dr_process_d_matrix() does.
+/// @param [in] num_tests The number of tests, and of columns
+/// @param [in] test_results The given test results, already checked
+/// @param [in] num_failure_modes The number of failure modes in each column
+/// @param [in] columns Column j starts at columns + (j * column_stride)
+/// @param [in] column_stride The distance between columns, at least num_failure_modes
+/// @param [out] state The failure mode state vector
+void dr_kernel_first_pass(uint32_t const num_tests,
+                          dr_test_result_type const test_results[num_tests],
+                          uint32_t const num_failure_modes,
+                          uint8_t const columns[],
+                          uint32_t const column_stride,
+                          uint8_t state[num_failure_modes]);
+
+#ifdef __cplusplus
+} // extern "C" {
+#endif
+
+
+#endif // DR_KERNELS_H
@@ -0,0 +1,178 @@
+#include "dr_log_format.h"
+
+#include <string.h>
+
+/////////////////////////////////////////////////////////////////
+// Public function definitions
+/////////////////////////////////////////////////////////////////
+
+uint32_t dr_log_record_size(uint32_t const num_tests,
+			    uint32_t const num_failure_modes)
+{
+  uint32_t const size = sizeof(dr_log_record_type) +
+    DR_LOG_PACKED_BYTES(num_tests) + DR_LOG_PACKED_BYTES(num_failure_modes);
+
+  return (size + 3) & ~3u;
+}
+
+uint32_t dr_log_delta_size(uint32_t const num_changes)
+{
+  uint32_t const size = sizeof(dr_log_delta_type) +
+    (num_changes * sizeof(uint16_t));
+
+  return (size + 3) & ~3u;
+}
+
+void dr_log_pack_test_results(
+  uint32_t const num_tests,
+  dr_test_result_type const test_results[num_tests],
+  uint8_t packed[DR_LOG_PACKED_BYTES(num_tests)])
+{
+  memset(packed, 0, DR_LOG_PACKED_BYTES(num_tests));
+
+  for(uint32_t i = 0; i < num_tests; ++i)
+  {
+    packed[i / 4] |= (uint8_t)((test_results[i] & 3u) << (2 * (i % 4)));
+  }
+}
+
+void dr_log_unpack_test_results(
+  uint32_t const num_tests,
+  uint8_t const packed[DR_LOG_PACKED_BYTES(num_tests)],
+  dr_test_result_type test_results[num_tests])
+{
+  for(uint32_t i = 0; i < num_tests; ++i)
+  {
+    test_results[i] =
+      (dr_test_result_type)((packed[i / 4] >> (2 * (i % 4))) & 3u);
+  }
+}
+
+void dr_log_pack_failure_modes(
+  uint32_t const num_failure_modes,
+  dr_failure_mode_type const failure_modes[num_failure_modes],
+  uint8_t packed[DR_LOG_PACKED_BYTES(num_failure_modes)])
+{
+  memset(packed, 0, DR_LOG_PACKED_BYTES(num_failure_modes));
+
+  for(uint32_t i = 0; i < num_failure_modes; ++i)
+  {
+    packed[i / 4] |= (uint8_t)((failure_modes[i] & 3u) << (2 * (i % 4)));
+  }
+}
+
+void dr_log_unpack_failure_modes(
+  uint32_t const num_failure_modes,
+  uint8_t const packed[DR_LOG_PACKED_BYTES(num_failure_modes)],
+  dr_failure_mode_type failure_modes[num_failure_modes])
+{
+  for(uint32_t i = 0; i < num_failure_modes; ++i)
+  {
+    failure_modes[i] =
+      (dr_failure_mode_type)((packed[i / 4] >> (2 * (i % 4))) & 3u);
+  }
+}
+
+uint32_t dr_log_diff_packed(
+  uint32_t const num_values,
+  uint8_t const previous[DR_LOG_PACKED_BYTES(num_values)],
+  uint8_t const current[DR_LOG_PACKED_BYTES(num_values)],
+  uint16_t changes[num_values])
+{
+  uint32_t num_changes = 0;
+  uint32_t const num_bytes = DR_LOG_PACKED_BYTES(num_values);
+
+  for(uint32_t b = 0; b < num_bytes; ++b)
+  {
+    uint8_t const changed = previous[b] ^ current[b];
+
+    if(0 != changed)
+    {
+      // The bits past the last value are clear in both, so never
+      // changed
+      for(uint32_t slot = 0; slot < 4; ++slot)
+      {
+	if(0 != ((changed >> (2 * slot)) & 3u))
+	{
+	  uint32_t const index = (b * 4) + slot;
+	  uint32_t const value = (current[b] >> (2 * slot)) & 3u;
+	  changes[num_changes++] = (uint16_t)((index << 2) | value);
+	}
+      }
+    }
+  }
+
+  return num_changes;
+}
+
+bool dr_log_apply_changes(
+  uint32_t const num_values,
+  uint32_t const num_changes,
+  uint16_t const changes[num_changes],
+  uint8_t packed[DR_LOG_PACKED_BYTES(num_values)])
+{
+  bool all_applied = true;
+
+  for(uint32_t i = 0; i < num_changes; ++i)
+  {
+    uint32_t const index = changes[i] >> 2;
+    uint32_t const shift = 2 * (index % 4);
+
+    if(index < num_values)
+    {
+      packed[index / 4] = (uint8_t)((packed[index / 4] & ~(3u << shift)) |
+				    ((changes[i] & 3u) << shift));
+    }
+    else
+    {
+      all_applied = false;
+    }
+  }
+
+  return all_applied;
+}
+
+void dr_log_swap_header(dr_log_header_type * const header)
+{
+  header->magic = dr_log_swap_uint32(header->magic);
+  header->version = dr_log_swap_uint32(header->version);
+  header->header_size = dr_log_swap_uint32(header->header_size);
+  header->record_size = dr_log_swap_uint32(header->record_size);
+  header->num_tests = dr_log_swap_uint32(header->num_tests);
+  header->num_failure_modes = dr_log_swap_uint32(header->num_failure_modes);
+  header->mode = (int32_t)dr_log_swap_uint32((uint32_t)header->mode);
+  header->d_matrix_crc = dr_log_swap_uint32(header->d_matrix_crc);
+  header->wtm_crc = dr_log_swap_uint32(header->wtm_crc);
+}
+
+void dr_log_swap_record(dr_log_record_type * const record)
+{
+  record->tag = dr_log_swap_uint32(record->tag);
+  record->iteration = (int32_t)dr_log_swap_uint32((uint32_t)record->iteration);
+  record->seconds = dr_log_swap_uint32(record->seconds);
+  record->subseconds = dr_log_swap_uint32(record->subseconds);
+  record->error = (int32_t)dr_log_swap_uint32((uint32_t)record->error);
+}
+
+void dr_log_swap_delta(dr_log_delta_type * const delta)
+{
+  delta->tag = dr_log_swap_uint32(delta->tag);
+  delta->iteration = (int32_t)dr_log_swap_uint32((uint32_t)delta->iteration);
+  delta->seconds = dr_log_swap_uint32(delta->seconds);
+  delta->subseconds = dr_log_swap_uint32(delta->subseconds);
+  delta->error = (int32_t)dr_log_swap_uint32((uint32_t)delta->error);
+  delta->num_test_changes = dr_log_swap_uint16(delta->num_test_changes);
+  delta->num_failure_mode_changes =
+    dr_log_swap_uint16(delta->num_failure_mode_changes);
+}
+
+uint32_t dr_log_swap_uint32(uint32_t const value)
+{
+  return ((value >> 24) & 0xFFu) | ((value >> 8) & 0xFF00u) |
+    ((value << 8) & 0xFF0000u) | ((value << 24) & 0xFF000000u);
+}
+
+uint16_t dr_log_swap_uint16(uint16_t const value)
+{
+  return (uint16_t)(((value >> 8) & 0xFFu) | ((value << 8) & 0xFF00u));
+}
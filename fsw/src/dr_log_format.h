@@ -0,0 +1,243 @@
+#ifndef DR_LOG_FORMAT_H
+#define DR_LOG_FORMAT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dr_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The binary diagnosis log. It is a sequence of segments, each a
+/// header followed by one record per diagnosis. A new segment starts
+/// whenever the model or mode changes, since the header gives the
+/// model size every record of the segment has. A record is either a
+/// keyframe, with every test result and failure mode, or a delta, with
+/// only those that changed since the record before it. A segment starts
+/// with a keyframe, so the values of any record can be rebuilt from the
+/// last keyframe before it. Everything is written in the byte order of
+/// the processor that wrote it, which a reader tells from the header's
+/// magic number. The formats here are also compiled by the host tools,
+/// so only use standard C types.
+
+/// The first word of a segment header, "DRLG" when read as big-endian
+#define DR_LOG_MAGIC 0x44524C47u
+
+/// The first word of a keyframe record, "DRRC" when read as big-endian
+#define DR_LOG_RECORD_TAG 0x44525243u
+
+/// The first word of a delta record, "DRDL" when read as big-endian
+#define DR_LOG_DELTA_TAG 0x4452444Cu
+
+/// The log format version, increased whenever the header or record
+/// layout changes. A reader should refuse versions it doesn't know.
+/// Version 1 logs have keyframes only.
+#define DR_LOG_VERSION 2
+
+/// The length of the table filenames kept in the header, including the
+/// terminating null.
+#define DR_LOG_FILENAME_LENGTH 64
+
+/// The bytes the 2-bit values of n tests or failure modes pack into, 4
+/// values to a byte.
+#define DR_LOG_PACKED_BYTES(n) (((n) + 3) / 4)
+
+/// The size of the fixed part of a record, dr_log_record_type.
+#define DR_LOG_RECORD_FIXED_SIZE 20
+
+/// The size of the fixed part of a delta record, dr_log_delta_type.
+#define DR_LOG_DELTA_FIXED_SIZE 24
+
+/// The size of a record of the largest model. No delta record is
+/// bigger than the keyframe of its model, since a keyframe is saved
+/// instead.
+#define DR_LOG_MAX_RECORD_SIZE						\
+  ((DR_LOG_RECORD_FIXED_SIZE + DR_LOG_PACKED_BYTES(DR_MAX_MODEL_TESTS) +	\
+    DR_LOG_PACKED_BYTES(DR_MAX_MODEL_FAILURE_MODES) + 3) & ~3)
+
+/// The header that starts a segment of the log, identifying the model
+/// its records are diagnoses of.
+typedef struct
+{
+  /// DR_LOG_MAGIC
+  uint32_t magic;
+  /// DR_LOG_VERSION
+  uint32_t version;
+  /// The size of this header, sizeof(dr_log_header_type)
+  uint32_t header_size;
+  /// The size of each record of the segment, from
+  /// dr_log_record_size()
+  uint32_t record_size;
+  /// The number of test results in each record
+  uint32_t num_tests;
+  /// The number of failure modes in each record
+  uint32_t num_failure_modes;
+  /// The mode being diagnosed
+  int32_t mode;
+  /// The CRCs of the d-matrix and wtm tables the model was compiled
+  /// from, as table services computes them
+  uint32_t d_matrix_crc;
+  uint32_t wtm_crc;
+  /// The files the d-matrix and wtm tables were loaded from, null
+  /// terminated and cut short if need be
+  char d_matrix_tbl_filename[DR_LOG_FILENAME_LENGTH];
+  char wtm_tbl_filename[DR_LOG_FILENAME_LENGTH];
+} dr_log_header_type;
+
+/// The fixed part of a record of one diagnosis. It is followed by the
+/// test results packed by dr_log_pack_test_results(), then the failure
+/// modes packed by dr_log_pack_failure_modes(), then padding to a
+/// multiple of 4 bytes. When the error isn't DR_ERROR_NO_ERROR the
+/// values are still there, but mean nothing.
+typedef struct
+{
+  /// DR_LOG_RECORD_TAG
+  uint32_t tag;
+  /// The number of the diagnosis since DR started
+  int32_t iteration;
+  /// The cFE time of the diagnosis
+  uint32_t seconds;
+  uint32_t subseconds;
+  /// The dr_error_type of the diagnosis
+  int32_t error;
+} dr_log_record_type;
+
+/// The fixed part of a delta record of one diagnosis. It is followed by
+/// the changes to the test results, then the changes to the failure
+/// modes, each a uint16_t from dr_log_diff_packed(), then padding to a
+/// multiple of 4 bytes. The values of the tests and failure modes
+/// not listed are those of the record before.
+typedef struct
+{
+  /// DR_LOG_DELTA_TAG
+  uint32_t tag;
+  /// The number of the diagnosis since DR started
+  int32_t iteration;
+  /// The cFE time of the diagnosis
+  uint32_t seconds;
+  uint32_t subseconds;
+  /// The dr_error_type of the diagnosis
+  int32_t error;
+  /// The number of test results that changed
+  uint16_t num_test_changes;
+  /// The number of failure modes that changed
+  uint16_t num_failure_mode_changes;
+} dr_log_delta_type;
+
+/// Returns the size of a record, including its packed values and
+/// padding.
+/// @param [in] num_tests The number of test results in the record
+/// @param [in] num_failure_modes The number of failure modes in the
+/// record
+uint32_t dr_log_record_size(uint32_t const num_tests,
+			    uint32_t const num_failure_modes);
+
+/// Returns the size of a delta record, including its changes and
+/// padding.
+/// @param [in] num_changes The number of test result and failure mode
+/// changes in the record
+uint32_t dr_log_delta_size(uint32_t const num_changes);
+
+/// Packs test results 4 to a byte, the first in the low 2 bits of the
+/// first byte.
+/// @param [in] num_tests The number of test results
+/// @param [in] test_results The test results
+/// @param [out] packed The DR_LOG_PACKED_BYTES(num_tests) bytes to pack
+/// them into
+void dr_log_pack_test_results(
+  uint32_t const num_tests,
+  dr_test_result_type const test_results[num_tests],
+  uint8_t packed[DR_LOG_PACKED_BYTES(num_tests)]);
+
+/// Unpacks test results packed by dr_log_pack_test_results().
+/// @param [in] num_tests The number of test results
+/// @param [in] packed The packed test results
+/// @param [out] test_results The test results
+void dr_log_unpack_test_results(
+  uint32_t const num_tests,
+  uint8_t const packed[DR_LOG_PACKED_BYTES(num_tests)],
+  dr_test_result_type test_results[num_tests]);
+
+/// Packs failure modes 4 to a byte, the first in the low 2 bits of the
+/// first byte.
+/// @param [in] num_failure_modes The number of failure modes
+/// @param [in] failure_modes The failure modes
+/// @param [out] packed The DR_LOG_PACKED_BYTES(num_failure_modes) bytes
+/// to pack them into
+void dr_log_pack_failure_modes(
+  uint32_t const num_failure_modes,
+  dr_failure_mode_type const failure_modes[num_failure_modes],
+  uint8_t packed[DR_LOG_PACKED_BYTES(num_failure_modes)]);
+
+/// Unpacks failure modes packed by dr_log_pack_failure_modes().
+/// @param [in] num_failure_modes The number of failure modes
+/// @param [in] packed The packed failure modes
+/// @param [out] failure_modes The failure modes
+void dr_log_unpack_failure_modes(
+  uint32_t const num_failure_modes,
+  uint8_t const packed[DR_LOG_PACKED_BYTES(num_failure_modes)],
+  dr_failure_mode_type failure_modes[num_failure_modes]);
+
+/// Lists the values that differ between two sets of packed test
+/// results or failure modes, as changes of a delta record. Each change
+/// is a value's index shifted left by 2, with the new value in the low
+/// 2 bits, so there may be up to 16384 values. Whole bytes are compared
+/// first, so values that stay the same cost little.
+/// @param [in] num_values The number of values packed
+/// @param [in] previous The values packed before
+/// @param [in] current The values packed now
+/// @param [out] changes The changes, in order of index, with room for
+/// num_values changes
+/// @return The number of changes
+uint32_t dr_log_diff_packed(
+  uint32_t const num_values,
+  uint8_t const previous[DR_LOG_PACKED_BYTES(num_values)],
+  uint8_t const current[DR_LOG_PACKED_BYTES(num_values)],
+  uint16_t changes[num_values]);
+
+/// Applies the changes listed by dr_log_diff_packed() to packed test
+/// results or failure modes.
+/// @param [in] num_values The number of values packed
+/// @param [in] num_changes The number of changes
+/// @param [in] changes The changes
+/// @param [inout] packed The values to change
+/// @return false if a change is of a value past num_values, which
+/// isn't applied; true otherwise
+bool dr_log_apply_changes(
+  uint32_t const num_values,
+  uint32_t const num_changes,
+  uint16_t const changes[num_changes],
+  uint8_t packed[DR_LOG_PACKED_BYTES(num_values)]);
+
+/// Reverses the byte order of the words of a header, for a reader on a
+/// processor of the other byte order.
+/// @param [inout] header The header to swap
+void dr_log_swap_header(dr_log_header_type * const header);
+
+/// Reverses the byte order of the words of a record, for a reader on a
+/// processor of the other byte order. The packed values are bytes, so
+/// they don't need swapping.
+/// @param [inout] record The record to swap
+void dr_log_swap_record(dr_log_record_type * const record);
+
+/// Reverses the byte order of the fixed part of a delta record, for a
+/// reader on a processor of the other byte order. The changes after it
+/// each need swapping with dr_log_swap_uint16().
+/// @param [inout] delta The delta record to swap
+void dr_log_swap_delta(dr_log_delta_type * const delta);
+
+/// Returns a word with its byte order reversed.
+/// @param [in] value The word to swap
+uint32_t dr_log_swap_uint32(uint32_t const value);
+
+/// Returns a half word with its byte order reversed.
+/// @param [in] value The half word to swap
+uint16_t dr_log_swap_uint16(uint16_t const value);
+
+#ifdef __cplusplus
+} // extern "C" {
+#endif
+
+#endif // DR_LOG_FORMAT_H
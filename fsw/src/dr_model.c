@@ -0,0 +1,177 @@
+
+#include "dr_model.h"
+
+#include <string.h>
+
+////////////////////////////////////////////////////////////////
+// Private function prototypes
+////////////////////////////////////////////////////////////////
+
+/// Returns true if the index is a watchpoint of the LC watchpoint
+/// results table.
+/// @param [in] max_watchpoints The number of watchpoints in the table
+/// @param [in] watchpoint_index The watchpoint index to check
+static bool is_watchpoint(uint32_t const max_watchpoints,
+                          uint32_t const watchpoint_index);
+
+/// Returns true if an active watchpoint to test mapping entry can be
+/// used as is by dr_process_tests().
+/// @param [in] max_watchpoints The number of watchpoints in the LC watchpoint results table
+/// @param [in] entry The entry to check
+static bool is_valid_wtm_entry(uint32_t const max_watchpoints,
+                               dr_wtm_entry_type const * const entry);
+
+/// Empties the model, leaving it with the given error. The d-matrix
+/// forms may still hold an older d-matrix, which the error keeps from
+/// being used.
+/// @param [inout] model The model to empty
+/// @param [in] error The error to leave in the model
+static void clear_model(dr_model_type * const model,
+                        dr_error_type const error);
+
+/////////////////////////////////////////////////////////////////
+// Public function definitions
+/////////////////////////////////////////////////////////////////
+
+void dr_init_model(dr_model_type * const model,
+                   dr_model_storage_type const * const storage)
+{
+  memset(model, 0, sizeof(*model));
+
+  dr_init_bitset_d_matrix(&(model->bitset),
+                          storage->bitset_rows, storage->bitset_cols,
+                          storage->max_tests, storage->max_failure_modes);
+  dr_init_sparse_d_matrix(&(model->sparse),
+                          storage->sparse_row_starts, storage->sparse_row_tests,
+                          storage->sparse_col_starts,
+                          storage->sparse_col_failure_modes,
+                          storage->max_tests, storage->max_failure_modes,
+                          storage->max_nonzeros);
+  model->components = storage->components;
+  model->gather_plan.max_watchpoints = storage->max_watchpoints;
+  model->gather_plan.watchpoints = storage->gather_watchpoints;
+  model->gather_plan.tests = storage->gather_tests;
+  model->gather_plan.clear_slots = storage->gather_clear_slots;
+
+  clear_model(model, DR_ERROR_INVALID_D_MATRIX);
+}
+
+dr_error_type dr_validate_d_matrix_tbl(
+  dr_d_matrix_packed_tbl_type const * const d_matrix_tbl)
+{
+  return dr_d_matrix_packed_header_is_valid(&(d_matrix_tbl->header)) ?
+    DR_ERROR_NO_ERROR : DR_ERROR_INVALID_D_MATRIX;
+}
+
+dr_error_type dr_validate_wtm_tbl(uint32_t const max_watchpoints,
+                                  uint32_t const num_entries,
+                                  dr_wtm_entry_type const wtm_tbl[num_entries])
+{
+  dr_error_type error = DR_ERROR_NO_ERROR;
+
+  for (uint32_t i = 0; (i < num_entries) && (DR_ERROR_NO_ERROR == error); ++i)
+  {
+    if ( wtm_tbl[i].test_active && !is_valid_wtm_entry(max_watchpoints, &(wtm_tbl[i])) )
+    {
+      error = DR_ERROR_INVALID_WTM;
+    }
+  }
+
+  return error;
+}
+
+dr_error_type dr_compile_model(dr_model_type * const model,
+                               dr_d_matrix_packed_tbl_type const * const d_matrix_tbl,
+                               dr_wtm_entry_type const * const wtm_tbl)
+{
+  dr_error_type error = dr_validate_d_matrix_tbl(d_matrix_tbl);
+
+  if (DR_ERROR_NO_ERROR == error)
+  {
+    error = dr_validate_wtm_tbl(model->gather_plan.max_watchpoints,
+                                DR_MAX_MODEL_TESTS, wtm_tbl);
+  }
+
+  // The mapping entries of the model's tests must also map to one of
+  // its tests, which is all dr_process_tests() relies on.
+  uint32_t const num_tests = d_matrix_tbl->header.num_tests;
+  for (uint32_t i = 0; (i < num_tests) && (DR_ERROR_NO_ERROR == error); ++i)
+  {
+    if ( wtm_tbl[i].test_active && (wtm_tbl[i].test_index >= num_tests) )
+    {
+      error = DR_ERROR_INVALID_WTM;
+    }
+  }
+
+  if (DR_ERROR_NO_ERROR == error)
+  {
+    error = dr_compile_packed_bitset_d_matrix(d_matrix_tbl, &(model->bitset));
+  }
+
+  if (DR_ERROR_NO_ERROR != error)
+  {
+    clear_model(model, error);
+  }
+  else
+  {
+    model->error = DR_ERROR_NO_ERROR;
+    model->num_tests = model->bitset.num_tests;
+    model->num_failure_modes = model->bitset.num_failure_modes;
+
+    model->sparse_error = dr_compile_sparse_d_matrix(&(model->bitset),
+                                                     &(model->sparse));
+    dr_partition_d_matrix(&(model->sparse), model->components);
+
+    dr_compile_gather_plan(&(model->gather_plan), num_tests, wtm_tbl);
+  }
+
+  return error;
+}
+
+////////////////////////////////////////////////////////////////
+// Private function definitions
+////////////////////////////////////////////////////////////////
+
+bool is_watchpoint(uint32_t const max_watchpoints,
+                   uint32_t const watchpoint_index)
+{
+  return (watchpoint_index < max_watchpoints);
+}
+
+bool is_valid_wtm_entry(uint32_t const max_watchpoints,
+                        dr_wtm_entry_type const * const entry)
+{
+  bool is_valid =
+    (entry->test_index < DR_MAX_MODEL_TESTS) &&
+    is_watchpoint(max_watchpoints, entry->watchpoint_index) &&
+    ( (UINT32_MAX == entry->test_valid_watchpoint_index) ||
+      is_watchpoint(max_watchpoints, entry->test_valid_watchpoint_index) ) &&
+    ( (DR_VALUE_TEST == entry->test_type) ||
+      (DR_STALENESS_TEST == entry->test_type) );
+
+  // The latch clear watchpoints are only used by latching tests
+  if (is_valid && entry->test_latching)
+  {
+    is_valid = (entry->latch_clear.latch_clear_count <= DR_MAX_CLEAR_CONDS);
+
+    for (uint32_t k = 0;
+         is_valid && (k < entry->latch_clear.latch_clear_count); ++k)
+    {
+      is_valid = is_watchpoint(max_watchpoints,
+                               entry->latch_clear.latch_clear_indices[k]);
+    }
+  }
+
+  return is_valid;
+}
+
+void clear_model(dr_model_type * const model,
+                 dr_error_type const error)
+{
+  model->error = error;
+  model->sparse_error = error;
+  model->num_tests = 0;
+  model->num_failure_modes = 0;
+  model->gather_plan.num_slots = 0;
+  model->gather_plan.num_tests = 0;
+}
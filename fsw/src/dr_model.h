@@ -0,0 +1,177 @@
+#ifndef DR_MODEL_H
+#define DR_MODEL_H
+
+#include <stdint.h>
+
+#include "dr_types.h"
+#include "dr_d_matrix_tbl.h"
+#include "dr_wtm_tbl.h"
+#include "dr_bitset_d_matrix.h"
+#include "dr_sparse_d_matrix.h"
+#include "dr_component_d_matrix.h"
+#include "dr_gather_plan.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The alignment of the model buffers, a cache line, so that no two
+/// buffers share a line and each bitset row starts on one.
+#define DR_MODEL_ALIGNMENT 64
+
+/// The number of buffers in a model's storage.
+#define DR_MODEL_STORAGE_BUFFERS 10
+
+/// The bytes of storage for a model of the given largest size, with room
+/// to align each of its buffers to DR_MODEL_ALIGNMENT.
+#define DR_MODEL_STORAGE_BYTES(max_tests, max_failure_modes, max_nonzeros, \
+			       max_watchpoints)				\
+  ((sizeof(dr_bitset_word_type) *					\
+    (DR_BITSET_ROW_STORAGE_WORDS(max_tests, max_failure_modes) +	\
+     DR_BITSET_COL_STORAGE_WORDS(max_tests, max_failure_modes))) +	\
+   (sizeof(dr_sparse_offset_type) * ((max_failure_modes) + (max_tests) + 2)) + \
+   (sizeof(dr_sparse_index_type) * 2 * (max_nonzeros)) +		\
+   sizeof(dr_components_type) +						\
+   (sizeof(uint32_t) * (max_watchpoints)) +				\
+   (sizeof(dr_gather_test_type) * (max_tests)) +			\
+   (sizeof(dr_gather_slot_type) * (max_tests) * DR_MAX_CLEAR_CONDS) +	\
+   (DR_MODEL_STORAGE_BUFFERS * DR_MODEL_ALIGNMENT))
+
+/// The storage for a model, sized for the largest model it may hold,
+/// which may be smaller than the largest model size. Filled in by the
+/// caller, normally from a memory pool, before dr_init_model().
+typedef struct
+{
+  /// The largest number of tests the storage holds, at most
+  /// DR_MAX_MODEL_TESTS. The sizes below are given for this.
+  uint32_t max_tests;
+
+  /// The largest number of failure modes the storage holds, at most
+  /// DR_MAX_MODEL_FAILURE_MODES.
+  uint32_t max_failure_modes;
+
+  /// The largest number of d-matrix entries set the storage holds for
+  /// the sparse d-matrix, at most DR_MAX_MODEL_NONZEROS.
+  uint32_t max_nonzeros;
+
+  /// The number of watchpoints in the LC watchpoint results table,
+  /// LC_MAX_WATCHPOINTS, which the gather plan may read.
+  uint32_t max_watchpoints;
+
+  /// DR_BITSET_ROW_STORAGE_WORDS(max_tests, max_failure_modes) words
+  /// for the bitset rows.
+  dr_bitset_word_type * bitset_rows;
+
+  /// DR_BITSET_COL_STORAGE_WORDS(max_tests, max_failure_modes) words
+  /// for the bitset columns.
+  dr_bitset_word_type * bitset_cols;
+
+  /// max_failure_modes + 1 offsets.
+  dr_sparse_offset_type * sparse_row_starts;
+
+  /// max_nonzeros indices.
+  dr_sparse_index_type * sparse_row_tests;
+
+  /// max_tests + 1 offsets.
+  dr_sparse_offset_type * sparse_col_starts;
+
+  /// max_nonzeros indices.
+  dr_sparse_index_type * sparse_col_failure_modes;
+
+  /// The connected components.
+  dr_components_type * components;
+
+  /// max_watchpoints watchpoint indices for the gather plan.
+  uint32_t * gather_watchpoints;
+
+  /// max_tests test descriptors for the gather plan.
+  dr_gather_test_type * gather_tests;
+
+  /// max_tests * DR_MAX_CLEAR_CONDS latch clear slots for the gather
+  /// plan.
+  dr_gather_slot_type * gather_clear_slots;
+
+} dr_model_storage_type;
+
+/// Everything the diagnosis needs from the d-matrix and watchpoint to
+/// test mapping tables, compiled once each time either table is loaded.
+/// Between loads the model isn't changed, so each diagnosis only reads
+/// it, and never has to check the tables again.
+typedef struct
+{
+  /// The error from the last compile. While this is set the model is
+  /// empty and can't be used.
+  dr_error_type error;
+
+  /// The error from compiling the sparse d-matrix, which can fail on
+  /// its own, for a d-matrix with too many entries. Only the sparse and
+  /// component engines need it.
+  dr_error_type sparse_error;
+
+  /// The number of tests in the model.
+  uint32_t num_tests;
+
+  /// The number of failure modes in the model.
+  uint32_t num_failure_modes;
+
+  /// The d-matrix compiled into bitsets.
+  dr_bitset_d_matrix_type bitset;
+
+  /// The d-matrix compressed to its entries that are set.
+  dr_sparse_d_matrix_type sparse;
+
+  /// The connected components of the sparse d-matrix.
+  dr_components_type * components;
+
+  /// The watchpoint to test mapping entries of the model's tests,
+  /// checked against the model and the LC watchpoint table size, and
+  /// compiled into the watchpoints to gather and the tests to evaluate.
+  dr_gather_plan_type gather_plan;
+
+} dr_model_type;
+
+/// Gives storage to a model, and leaves it empty with the error
+/// DR_ERROR_INVALID_D_MATRIX until the first compile.
+/// @param [out] model The model to initialize
+/// @param [in] storage The storage for the model, which fixes the largest model it may hold
+void dr_init_model(dr_model_type * const model,
+                   dr_model_storage_type const * const storage);
+
+/// Checks a packed d-matrix table on its own, as the table validation
+/// function does before a load is accepted.
+/// @param [in] d_matrix_tbl The packed d-matrix table to check
+/// @return DR_ERROR_INVALID_D_MATRIX if the header is wrong or too big
+dr_error_type dr_validate_d_matrix_tbl(
+  dr_d_matrix_packed_tbl_type const * const d_matrix_tbl);
+
+/// Checks a watchpoint to test mapping table on its own, as the table
+/// validation function does before a load is accepted. Only the active
+/// entries are checked: their test index must be a model test, and
+/// their watchpoint indices must be in the LC watchpoint results table.
+/// @param [in] max_watchpoints The number of watchpoints in the LC watchpoint results table, LC_MAX_WATCHPOINTS
+/// @param [in] num_entries The number of entries in the table
+/// @param [in] wtm_tbl The watchpoint to test mapping table to check
+/// @return DR_ERROR_INVALID_WTM if an active entry is wrong
+dr_error_type dr_validate_wtm_tbl(uint32_t const max_watchpoints,
+                                  uint32_t const num_entries,
+                                  dr_wtm_entry_type const wtm_tbl[num_entries]);
+
+/// Compiles the d-matrix and watchpoint to test mapping tables into the
+/// model. The tables are checked as by the validation functions, with
+/// the max_watchpoints of the model's storage, and the active mapping
+/// entries must also map to a test of this d-matrix.
+/// If an error is returned the model is left empty with that error.
+/// @param [inout] model The model, already given storage
+/// @param [in] d_matrix_tbl The packed d-matrix table
+/// @param [in] wtm_tbl The watchpoint to test mapping table, with DR_MAX_MODEL_TESTS entries
+/// @return The error stored in the model
+dr_error_type dr_compile_model(dr_model_type * const model,
+                               dr_d_matrix_packed_tbl_type const * const d_matrix_tbl,
+                               dr_wtm_entry_type const * const wtm_tbl);
+
+#ifdef __cplusplus
+} // extern "C" {
+#endif
+
+
+#endif // DR_MODEL_H
@@ -1,74 +1,143 @@
-/*******************************************************************************
-** File:
-**   dr_msg.h 
-**
-** Purpose: 
-**  Define DR Messages and info
-**
-** Notes:
-**
-**
-*******************************************************************************/
-#ifndef dr_msg_h
-#define dr_msg_h
-
-#include "dr_types.h"
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-
-// DR command codes
-
-#define DR_NOOP_CC                 0
-#define DR_RESET_COUNTERS_CC       1
-#define DR_CHANGE_MODE_CC          2
-
-// Generic "no arguments" command
-typedef struct
-{
-   uint8    CmdHeader[CFE_SB_CMD_HDR_SIZE];
-
-} dr_no_args_cmd_type;
-
-// Generic "no arguments" command
-typedef struct
-{
-   uint8    CmdHeader[CFE_SB_CMD_HDR_SIZE];
-   uint32   NewMode;
-} dr_change_mode_cmd_type; 
-
-// DR housekeeping typedef
-typedef struct 
-{
-    uint8              TlmHeader[CFE_SB_TLM_HDR_SIZE];
-    uint8              dr_command_error_count;
-    uint8              dr_command_count;
-} dr_hk_tlm_type;
-  
-#define DR_HK_TLM_LNGTH   sizeof ( dr_hk_tlm_type )
-
-// DR diagnosis struct
-typedef struct
-{
-  /** The cFS message header */
-  uint8    TlmHeader[CFE_SB_TLM_HDR_SIZE];
-  /** Whether an error occurred in the diagnosis */
-  dr_error_type  error;
-  /** The number of failure modes in the diagnosis */
-  uint32_t num_failure_modes;
-  /** The good/bad state of each failure mode */
-  dr_failure_mode_type failure_modes[DR_MAX_FAILURE_MODES];
-} dr_diagnosis_msg_type;  
-
-
-#ifdef __cplusplus
-} // extern "C" {
-#endif
-
-#endif // dr_msg_h 
-
-/************************/
-/*  End of File Comment */
-/************************/
+/*******************************************************************************
+** File:
+**   dr_msg.h 
+**
+** Purpose: 
+**  Define DR Messages and info
+**
+** Notes:
+**
+**
+*******************************************************************************/
+#ifndef dr_msg_h
+#define dr_msg_h
+
+#include <stddef.h>
+
+#include "dr_types.h"
+#include "dr_stats.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// DR command codes
+
+#define DR_NOOP_CC                 0
+#define DR_RESET_COUNTERS_CC       1
+#define DR_CHANGE_MODE_CC          2
+#define DR_SEND_PERF_CC            3
+#define DR_RESET_PERF_CC           4
+
+// Generic "no arguments" command
+typedef struct
+{
+   uint8    CmdHeader[CFE_SB_CMD_HDR_SIZE];
+
+} dr_no_args_cmd_type;
+
+// Generic "no arguments" command
+typedef struct
+{
+   uint8    CmdHeader[CFE_SB_CMD_HDR_SIZE];
+   uint32   NewMode;
+} dr_change_mode_cmd_type; 
+
+// The steps of a mode change, in order. The DR tables are loaded, one
+// per step, and compiled in DR_MODE_CHANGE_LOADING_MODEL, before LC's
+// watchpoint definition table is checked and loaded, and the new model
+// replaces the old one once LC's table is active, in
+// DR_MODE_CHANGE_SWITCHING_MODEL. A cached mode's model skips the DR
+// table loads. DR_MODE_CHANGE_SWITCHING_MODEL is never seen in
+// telemetry. DR doesn't diagnose while DR_MODE_CHANGE_ACTIVATING_LC_WDT.
+typedef enum
+{
+  DR_MODE_CHANGE_IDLE = 0,
+  DR_MODE_CHANGE_LOADING_D_MATRIX,
+  DR_MODE_CHANGE_LOADING_WTM,
+  DR_MODE_CHANGE_LOADING_MODEL,
+  DR_MODE_CHANGE_CHECKING_LC_WDT,
+  DR_MODE_CHANGE_LOADING_LC_WDT,
+  DR_MODE_CHANGE_VALIDATING_LC_WDT,
+  DR_MODE_CHANGE_ACTIVATING_LC_WDT,
+  DR_MODE_CHANGE_SWITCHING_MODEL,
+  DR_MODE_CHANGE_STATE_COUNT
+} dr_mode_change_state_type;
+
+// DR housekeeping typedef
+typedef struct 
+{
+    uint8              TlmHeader[CFE_SB_TLM_HDR_SIZE];
+    uint8              dr_command_error_count;
+    uint8              dr_command_count;
+    /** The dr_mode_change_state_type step of the mode change in
+        progress, DR_MODE_CHANGE_IDLE if there is none */
+    uint8              dr_mode_change_state;
+    /** The mode changes that failed, the old mode is kept */
+    uint8              dr_mode_change_error_count;
+    /** The wakeups whose test results were the same as the last
+        diagnosis, which was sent again instead of solving */
+    uint32             dr_skipped_diagnosis_count;
+    /** The diagnoses sent with an error, such as a model that failed to
+        compile or an engine that can't solve it */
+    uint32             dr_diagnosis_error_count;
+    /** The diagnoses that couldn't be saved to the results files */
+    uint32             dr_save_error_count;
+    /** The mode being diagnosed */
+    uint32             dr_mode;
+    /** The mode being changed to, the same as dr_mode when no change
+        is in progress */
+    uint32             dr_requested_mode;
+    /** How long each step of the last mode change took in microseconds,
+        indexed by dr_mode_change_state_type, 0 for a step it skipped.
+        The DR_MODE_CHANGE_IDLE entry is the whole change, from the
+        command to the switch or the failure. */
+    uint32             dr_mode_change_step_usec[DR_MODE_CHANGE_STATE_COUNT];
+} dr_hk_tlm_type;
+  
+#define DR_HK_TLM_LNGTH   sizeof ( dr_hk_tlm_type )
+
+// DR performance telemetry, sent on the DR_SEND_PERF_CC command
+typedef struct
+{
+  /** The cFS message header */
+  uint8    TlmHeader[CFE_SB_TLM_HDR_SIZE];
+  /** The number of entries of stages, DR_STATS_STAGE_COUNT */
+  uint32   num_stages;
+  /** The timing of each dr_stats_stage_type interval of a wakeup since
+      DR started or the last DR_RESET_PERF_CC command */
+  dr_stats_type stages[DR_STATS_STAGE_COUNT];
+} dr_perf_tlm_type;
+
+#define DR_PERF_TLM_LNGTH   sizeof ( dr_perf_tlm_type )
+
+// DR diagnosis struct
+typedef struct
+{
+  /** The cFS message header */
+  uint8    TlmHeader[CFE_SB_TLM_HDR_SIZE];
+  /** Whether an error occurred in the diagnosis */
+  dr_error_type  error;
+  /** The number of failure modes in the diagnosis */
+  uint32_t num_failure_modes;
+  /** The good/bad state of each failure mode. Only the first
+      num_failure_modes are sent. */
+  dr_failure_mode_type failure_modes[DR_MAX_MODEL_FAILURE_MODES];
+} dr_diagnosis_msg_type;  
+
+/** The length of a diagnosis message with the given number of failure modes */
+#define DR_DIAGNOSIS_MSG_LNGTH(num_failure_modes) \
+  (offsetof(dr_diagnosis_msg_type, failure_modes) + \
+   (sizeof(dr_failure_mode_type) * (num_failure_modes)))
+
+
+#ifdef __cplusplus
+} // extern "C" {
+#endif
+
+#endif // dr_msg_h 
+
+/************************/
+/*  End of File Comment */
+/************************/
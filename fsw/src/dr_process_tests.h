@@ -1,31 +1,48 @@
-
-#ifndef DR_PROCESS_TESTS_H
-#define DR_PROCESS_TESTS_H
-
-#include "cfe.h"
-
-#include "dr_types.h"
-#include "dr_wtm_tbl.h"
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-////////////////////////////////////////////////////////////////////////
-// Public Functions
-////////////////////////////////////////////////////////////////////////
-
-/// Main public function, to determine the test results. As described
-/// elsewhere, this will read the Limit Checker (LC) watchpoint results
-/// table and translate those into the test results. 
-int32 dr_process_tests(CFE_TBL_Handle_t const DR_LC_WRTHandle,
-		       dr_wtm_entry_type const * const dr_wtm_ptr,
-		       uint32_t const num_tests,
-		       dr_test_result_type test_results[num_tests]);
-  
-#ifdef __cplusplus
-} // extern "C" {
-#endif
-
-  
-#endif // DR_PROCESS_TESTS_H 
+
+#ifndef DR_PROCESS_TESTS_H
+#define DR_PROCESS_TESTS_H
+
+#include "cfe.h"
+
+#include "lc_platform_cfg.h" // for LC_MAX_WATCHPOINTS
+
+#include "dr_types.h"
+#include "dr_wtm_tbl.h"
+#include "dr_gather_plan.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if LC_MAX_WATCHPOINTS >= DR_GATHER_NO_SLOT
+#error "LC_MAX_WATCHPOINTS doesn't fit a dr_gather_slot_type"
+#endif
+
+////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////
+
+/// Main public function, to determine the test results. As described
+/// elsewhere, this will read the Limit Checker (LC) watchpoint results
+/// table and translate those into the test results. The gather plan,
+/// from dr_compile_gather_plan(), must map every active test to a test
+/// index less than num_tests, as dr_compile_model() checks.
+/// The previous test results, used for the latching tests, are updated
+/// to the new ones. The watchpoint results table is only held while the
+/// watch results of the plan are copied out of it, in increasing
+/// watchpoint order; the tests are evaluated from the copy after it is
+/// released. results_changed is set false only if the new test results
+/// are exactly the previous ones, so the diagnosis can be reused.
+int32 dr_process_tests(CFE_TBL_Handle_t const DR_LC_WRTHandle,
+		       dr_gather_plan_type const * const plan,
+		       uint32_t const num_tests,
+		       dr_test_result_type test_results[num_tests],
+		       dr_test_result_type prev_test_results[num_tests],
+		       bool * const results_changed);
+  
+#ifdef __cplusplus
+} // extern "C" {
+#endif
+
+  
+#endif // DR_PROCESS_TESTS_H 
@@ -1,258 +1,548 @@
-#include "dr_save_results.h"
-
-#include <stdbool.h>
-
-#include "osapi.h"
-
-
-static const int MAX_FORMAT_BUFFER_SIZE = 32;
-
-static int32 test_results_filedesc = OS_ERROR;
-static int32 failure_modes_filedesc = OS_ERROR;
-
-static bool save_int_csv(int32 filedesc, int const value);
-static bool save_eol(int32 filedes);
-
-static bool save_test_results(
-  int const iteration,
-  dr_error_type const error,
-  int const num_tests,
-  dr_test_result_type const test_results[num_tests]);
-
-static bool save_failure_modes(
-  int const iteration,
-  dr_error_type const error,
-  int const num_failure_modes,
-  dr_failure_mode_type const failure_modes[num_failure_modes]);
-
-dr_error_type dr_open_results_files(
-  char const * const test_results_filename,
-  char const * const failure_modes_filename)
-{
-  dr_error_type result = DR_ERROR_NO_ERROR;
-
-  // Looking at OSAL osfileapi.c OS_open(), it looks as if errors are
-  // negative numbers, and file descriptors may be from 0 to
-  // OS_MAX_NUM_OPEN_FILES. So, test for failure of this call by checking
-  // that the resulting file descriptor is less than 0.
-  test_results_filedesc = OS_creat(test_results_filename, OS_WRITE_ONLY);
-  
-  if(test_results_filedesc < 0)
-  {
-    result = DR_ERROR_FILE_ERROR;
-  }
-
-  // Open the failure modes file 
-  if(DR_ERROR_NO_ERROR == result)
-  {
-    failure_modes_filedesc = OS_creat(failure_modes_filename, OS_WRITE_ONLY);
-    
-    if(failure_modes_filedesc < 0)
-    {
-      result = DR_ERROR_FILE_ERROR;
-      // Here we have created the test results file but not the
-      // failure modes file. Attempt to close the file that was opened,
-      // but since we are returning an error already, don't do anything with
-      // the return result of this close.
-      OS_close(test_results_filedesc);
-    }
-  }
-
-  return result;
-}
-
-dr_error_type dr_close_results_files(void)
-{
-  dr_error_type result = DR_ERROR_NO_ERROR;
-
-  // Attempt to close both of the files
-  int32 test_results_close_result = OS_close(test_results_filedesc);
-  int32 failure_modes_close_result = OS_close(failure_modes_filedesc);
-
-  // If either call failed, report an error
-  if( (OS_FS_SUCCESS != test_results_close_result) ||
-      (OS_FS_SUCCESS != failure_modes_close_result) )
-  {
-    result = DR_ERROR_FILE_ERROR;
-  }
-
-  return result;
-}
-
-
-dr_error_type dr_save_results(
-  int const iteration,
-  dr_error_type const error,
-  int const num_tests,
-  dr_test_result_type const test_results[num_tests],
-  int const num_failure_modes,
-  dr_failure_mode_type const failure_modes[num_failure_modes])
-{
-
-  dr_error_type result = DR_ERROR_NO_ERROR;
-
-  // Save the test results, and if there was an error set
-  // the result accordingly
-  bool save_tr_success =
-    save_test_results(iteration, error, num_tests, test_results);
-
-  if(!save_tr_success)
-  {
-    result = DR_ERROR_SAVE_ERROR;
-  }
-
-  // OS_printf("DR: dr_save_results(): save_tr_success = %d\n", save_tr_success);
-
-  // Save the failure modes, and if there was an error set
-  // the result accordingly
-  if(DR_ERROR_NO_ERROR == result)
-  {
-    bool save_fm_success =
-      save_failure_modes(iteration, error, num_failure_modes, failure_modes);
-    
-    if(!save_fm_success)
-    {
-      result = DR_ERROR_SAVE_ERROR;
-    }
-  }
-  
-  return result;
-  
-}
-
-bool save_test_results(
-  int const iteration,
-  dr_error_type const error,
-  int const num_tests,
-  dr_test_result_type const test_results[num_tests])
-{
-
-  // OS_printf("DR in save test results: num test results = %d\n", num_tests);
-  
-  
-  // First write the iteration and AOS error code
-  bool success = save_int_csv(test_results_filedesc, iteration);
-
-  if(success)
-  {
-    success = save_int_csv(test_results_filedesc, (int const)error);
-  }
-  else
-  {
-    // OS_printf("DR: Only saved iteration...\n");
-  }
-
-  // Then if we are still successful, AND the AOS error code was good,
-  // save the test results
-  if(success && (DR_ERROR_NO_ERROR == error) )
-  {
-    for(int i = 0; i < num_tests; ++i)
-    {
-      success = save_int_csv(test_results_filedesc,
-				  (int const)test_results[i]);
-      
-      if(!success)
-      {
-	break;
-      }
-    }
-  }
-
-  // OS_printf("DR: save_test_results(): after saving test results, success = %d\n", success);
-
-  // Finally add the EOL 
-  if(success)
-  {
-    success = save_eol(test_results_filedesc);
-  }
-
-  // OS_printf("DR: save_test_results(): after save_eol, success = %d\n", success);
-
-  return success;
-}
-
-static bool save_failure_modes(
-  int const iteration,
-  dr_error_type const error,
-  int const num_failure_modes,
-  dr_failure_mode_type const failure_modes[num_failure_modes])
-{
-  // First write the iteration and AOS error code
-  bool success = save_int_csv(failure_modes_filedesc, iteration);
-
-  if(success)
-  {
-    success = save_int_csv(failure_modes_filedesc, (int const)error);
-  }
-
-  // OS_printf("DR: save_failure_modes(): success = %d\n", success);
-
-  // Then if we are still successful, AND the AOS error code was good,
-  // save the failure modes
-  if(success && (DR_ERROR_NO_ERROR == error) )
-  {
-    for(int i = 0; i < num_failure_modes; ++i)
-    {
-      success = save_int_csv(failure_modes_filedesc,
-				  (int const)failure_modes[i]);
-      
-      if(!success)
-      {
-	break;
-      }
-    }
-  }
-
-  // Finally add the EOL 
-  if(success)
-  {
-    success = save_eol(failure_modes_filedesc);
-  }
-
-  return success;
-}
-
-static bool save_int_csv(int32 filedes, int const value)
-{
-  bool success = true;
-  
-  char buffer[MAX_FORMAT_BUFFER_SIZE];
-
-  // Format the int into the buffer, and indicate error if a
-  // formatting error occurred or the buffer wasn't big enough
-  int chars_needed = snprintf(buffer, MAX_FORMAT_BUFFER_SIZE,
-			      "%d, ", value);
-
-  if( (chars_needed < 0) ||
-      (chars_needed >= MAX_FORMAT_BUFFER_SIZE) )
-  {
-    success = false;
-  }
-
-  // Write the formatted value to the file
-  if(success)
-  {
-    int32 os_code = OS_write(filedes, buffer, chars_needed);
-    
-    if(os_code < 0) // OS errors are all < 0. 
-    {
-      success = false;
-    }
-  }
-
-  return success;
-}
-
-static bool save_eol(int32 filedes)
-{
-  bool success = true;
-
-  int32 os_code = OS_write(filedes, "\n", 1);
-  
-  if(os_code < 0) // OS errors are all < 0. 
-  {
-    success = false;
-  }
-  
-  return success;
-}
+#include "dr_save_results.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "osapi.h"
+#include "dr_platform_cfg.h" // for DR_RESULTS_FLUSH_ROWS
+#include "dr_log_format.h"
+
+
+// The longest value save_int_csv() appends, the most negative int and
+// its separator.
+#define MAX_INT_CSV_LENGTH 13
+
+#if DR_RESULTS_BUFFER_SIZE < (2 * MAX_INT_CSV_LENGTH)
+#error DR_RESULTS_BUFFER_SIZE is too small for a row to make progress
+#endif
+
+#if (DR_RESULTS_LOG_FORMAT == DR_RESULTS_BINARY) && \
+  (DR_RESULTS_BUFFER_SIZE < DR_LOG_MAX_RECORD_SIZE)
+#error DR_RESULTS_BUFFER_SIZE is too small for a record of the largest model
+#endif
+
+#if DR_RESULTS_KEYFRAME_INTERVAL < 1
+#error DR_RESULTS_KEYFRAME_INTERVAL must be at least 1
+#endif
+
+// A results file, and what was saved to it but not yet written. Rows
+// are built in the buffer and written every DR_RESULTS_FLUSH_ROWS rows,
+// or when the buffer is full.
+typedef struct
+{
+  int32 filedes;
+  uint32 num_bytes;
+  uint32 num_rows;
+  char buffer[DR_RESULTS_BUFFER_SIZE];
+} results_file_type;
+
+static results_file_type test_results_file = { OS_ERROR, 0, 0, { 0 } };
+static results_file_type failure_modes_file = { OS_ERROR, 0, 0, { 0 } };
+static results_file_type results_log_file = { OS_ERROR, 0, 0, { 0 } };
+
+// The packed values of the record being saved and of the one before,
+// which a delta record lists the changes from, and those changes. A
+// keyframe is saved every DR_RESULTS_KEYFRAME_INTERVAL records, and
+// whenever the reader might not have the values before.
+static uint8 log_values[DR_LOG_MAX_RECORD_SIZE];
+static uint8 log_previous_values[DR_LOG_MAX_RECORD_SIZE];
+static uint16 log_changes[DR_MAX_MODEL_TESTS + DR_MAX_MODEL_FAILURE_MODES];
+static uint32 log_records_since_keyframe = 0;
+static bool log_keyframe_needed = true;
+
+static bool save_int_csv(results_file_type * const file, int const value);
+static bool save_eol(results_file_type * const file);
+static bool flush_results_file(results_file_type * const file);
+static bool make_room(results_file_type * const file, uint32 const size);
+static uint32 format_int(char * const text, int const value);
+
+static bool save_test_results(
+  int const iteration,
+  dr_error_type const error,
+  int const num_tests,
+  dr_test_result_type const test_results[num_tests]);
+
+static bool save_failure_modes(
+  int const iteration,
+  dr_error_type const error,
+  int const num_failure_modes,
+  dr_failure_mode_type const failure_modes[num_failure_modes]);
+
+dr_error_type dr_open_results_files(
+  char const * const test_results_filename,
+  char const * const failure_modes_filename)
+{
+  dr_error_type result = DR_ERROR_NO_ERROR;
+
+  // Looking at OSAL osfileapi.c OS_open(), it looks as if errors are
+  // negative numbers, and file descriptors may be from 0 to
+  // OS_MAX_NUM_OPEN_FILES. So, test for failure of this call by checking
+  // that the resulting file descriptor is less than 0.
+  test_results_file.filedes = OS_creat(test_results_filename, OS_WRITE_ONLY);
+  test_results_file.num_bytes = 0;
+  test_results_file.num_rows = 0;
+  
+  if(test_results_file.filedes < 0)
+  {
+    result = DR_ERROR_FILE_ERROR;
+  }
+
+  // Open the failure modes file 
+  if(DR_ERROR_NO_ERROR == result)
+  {
+    failure_modes_file.filedes = OS_creat(failure_modes_filename, OS_WRITE_ONLY);
+    failure_modes_file.num_bytes = 0;
+    failure_modes_file.num_rows = 0;
+    
+    if(failure_modes_file.filedes < 0)
+    {
+      result = DR_ERROR_FILE_ERROR;
+      // Here we have created the test results file but not the
+      // failure modes file. Attempt to close the file that was opened,
+      // but since we are returning an error already, don't do anything with
+      // the return result of this close.
+      OS_close(test_results_file.filedes);
+    }
+  }
+
+  return result;
+}
+
+dr_error_type dr_close_results_files(void)
+{
+  dr_error_type result = DR_ERROR_NO_ERROR;
+
+  // Write out the rows still buffered
+  bool test_results_flushed = flush_results_file(&test_results_file);
+  bool failure_modes_flushed = flush_results_file(&failure_modes_file);
+
+  // Attempt to close both of the files
+  int32 test_results_close_result = OS_close(test_results_file.filedes);
+  int32 failure_modes_close_result = OS_close(failure_modes_file.filedes);
+
+  // If either call failed, report an error
+  if( !test_results_flushed || !failure_modes_flushed ||
+      (OS_FS_SUCCESS != test_results_close_result) ||
+      (OS_FS_SUCCESS != failure_modes_close_result) )
+  {
+    result = DR_ERROR_FILE_ERROR;
+  }
+
+  return result;
+}
+
+
+dr_error_type dr_save_results(
+  int const iteration,
+  dr_error_type const error,
+  int const num_tests,
+  dr_test_result_type const test_results[num_tests],
+  int const num_failure_modes,
+  dr_failure_mode_type const failure_modes[num_failure_modes])
+{
+
+  dr_error_type result = DR_ERROR_NO_ERROR;
+
+  // Save the test results, and if there was an error set
+  // the result accordingly
+  bool save_tr_success =
+    save_test_results(iteration, error, num_tests, test_results);
+
+  if(!save_tr_success)
+  {
+    result = DR_ERROR_SAVE_ERROR;
+  }
+
+  // OS_printf("DR: dr_save_results(): save_tr_success = %d\n", save_tr_success);
+
+  // Save the failure modes, and if there was an error set
+  // the result accordingly
+  if(DR_ERROR_NO_ERROR == result)
+  {
+    bool save_fm_success =
+      save_failure_modes(iteration, error, num_failure_modes, failure_modes);
+    
+    if(!save_fm_success)
+    {
+      result = DR_ERROR_SAVE_ERROR;
+    }
+  }
+  
+  return result;
+  
+}
+
+dr_error_type dr_open_results_log(char const * const log_filename)
+{
+  dr_error_type result = DR_ERROR_NO_ERROR;
+
+  results_log_file.filedes = OS_creat(log_filename, OS_WRITE_ONLY);
+  results_log_file.num_bytes = 0;
+  results_log_file.num_rows = 0;
+  log_keyframe_needed = true;
+
+  if(results_log_file.filedes < 0)
+  {
+    result = DR_ERROR_FILE_ERROR;
+  }
+
+  return result;
+}
+
+dr_error_type dr_close_results_log(void)
+{
+  dr_error_type result = DR_ERROR_NO_ERROR;
+
+  // Write out the records still buffered, then close the file
+  bool flushed = flush_results_file(&results_log_file);
+  int32 close_result = OS_close(results_log_file.filedes);
+
+  if( !flushed || (OS_FS_SUCCESS != close_result) )
+  {
+    result = DR_ERROR_FILE_ERROR;
+  }
+
+  return result;
+}
+
+dr_error_type dr_save_results_log_header(
+  dr_log_header_type const * const header)
+{
+  dr_error_type result = DR_ERROR_NO_ERROR;
+
+  dr_log_header_type saved = *header;
+  saved.magic = DR_LOG_MAGIC;
+  saved.version = DR_LOG_VERSION;
+  saved.header_size = sizeof(saved);
+  saved.record_size = dr_log_record_size(saved.num_tests,
+					 saved.num_failure_modes);
+
+  // A segment starts with a keyframe. So does whatever follows a header
+  // that couldn't be saved, since the records before it may be of
+  // another model.
+  log_keyframe_needed = true;
+
+  if(make_room(&results_log_file, sizeof(saved)))
+  {
+    memcpy(&results_log_file.buffer[results_log_file.num_bytes], &saved,
+	   sizeof(saved));
+    results_log_file.num_bytes += sizeof(saved);
+  }
+  else
+  {
+    result = DR_ERROR_SAVE_ERROR;
+  }
+
+  return result;
+}
+
+dr_error_type dr_save_results_log(
+  int const iteration,
+  uint32_t const seconds,
+  uint32_t const subseconds,
+  dr_error_type const error,
+  int const num_tests,
+  dr_test_result_type const test_results[num_tests],
+  int const num_failure_modes,
+  dr_failure_mode_type const failure_modes[num_failure_modes])
+{
+  dr_error_type result = DR_ERROR_NO_ERROR;
+
+  // Pack the values as a keyframe has them
+  uint32 const num_test_bytes = DR_LOG_PACKED_BYTES(num_tests);
+  uint32 const num_value_bytes =
+    num_test_bytes + DR_LOG_PACKED_BYTES(num_failure_modes);
+  dr_log_pack_test_results(num_tests, test_results, log_values);
+  dr_log_pack_failure_modes(num_failure_modes, failure_modes,
+			    &log_values[num_test_bytes]);
+
+  // Save a delta record of the values that changed since the previous
+  // record, unless a keyframe is due, or the delta would be no smaller
+  uint32 record_size = dr_log_record_size(num_tests, num_failure_modes);
+  uint32 num_test_changes = 0;
+  uint32 num_failure_mode_changes = 0;
+  bool keyframe = log_keyframe_needed ||
+    (log_records_since_keyframe >= DR_RESULTS_KEYFRAME_INTERVAL);
+
+  if(!keyframe)
+  {
+    num_test_changes = dr_log_diff_packed(num_tests, log_previous_values,
+					  log_values, log_changes);
+    num_failure_mode_changes =
+      dr_log_diff_packed(num_failure_modes,
+			 &log_previous_values[num_test_bytes],
+			 &log_values[num_test_bytes],
+			 &log_changes[num_test_changes]);
+
+    uint32 const delta_size =
+      dr_log_delta_size(num_test_changes + num_failure_mode_changes);
+
+    keyframe = (delta_size >= record_size);
+    if(!keyframe)
+    {
+      record_size = delta_size;
+    }
+  }
+
+  if(make_room(&results_log_file, record_size))
+  {
+    uint8 * const bytes =
+      (uint8 *)&results_log_file.buffer[results_log_file.num_bytes];
+
+    // Clear the padding too, so the file doesn't depend on what was
+    // in the buffer
+    memset(bytes, 0, record_size);
+
+    if(keyframe)
+    {
+      dr_log_record_type const record =
+	{ DR_LOG_RECORD_TAG, iteration, seconds, subseconds, (int32)error };
+
+      memcpy(bytes, &record, sizeof(record));
+      memcpy(&bytes[sizeof(record)], log_values, num_value_bytes);
+      log_records_since_keyframe = 1;
+    }
+    else
+    {
+      dr_log_delta_type const delta =
+	{ DR_LOG_DELTA_TAG, iteration, seconds, subseconds, (int32)error,
+	  (uint16)num_test_changes, (uint16)num_failure_mode_changes };
+
+      memcpy(bytes, &delta, sizeof(delta));
+      memcpy(&bytes[sizeof(delta)], log_changes,
+	     (num_test_changes + num_failure_mode_changes) *
+	     sizeof(log_changes[0]));
+      log_records_since_keyframe++;
+    }
+
+    memcpy(log_previous_values, log_values, num_value_bytes);
+    log_keyframe_needed = false;
+
+    results_log_file.num_bytes += record_size;
+    results_log_file.num_rows++;
+
+    if( (results_log_file.num_rows >= DR_RESULTS_FLUSH_ROWS) &&
+	!flush_results_file(&results_log_file) )
+    {
+      result = DR_ERROR_SAVE_ERROR;
+    }
+  }
+  else
+  {
+    result = DR_ERROR_SAVE_ERROR;
+  }
+
+  // Records that couldn't be written are lost, and a delta after them
+  // would change values the reader never had, so start again from a
+  // keyframe.
+  if(DR_ERROR_NO_ERROR != result)
+  {
+    log_keyframe_needed = true;
+  }
+
+  return result;
+}
+
+bool save_test_results(
+  int const iteration,
+  dr_error_type const error,
+  int const num_tests,
+  dr_test_result_type const test_results[num_tests])
+{
+
+  // OS_printf("DR in save test results: num test results = %d\n", num_tests);
+  
+  
+  // First write the iteration and AOS error code
+  bool success = save_int_csv(&test_results_file, iteration);
+
+  if(success)
+  {
+    success = save_int_csv(&test_results_file, (int const)error);
+  }
+  else
+  {
+    // OS_printf("DR: Only saved iteration...\n");
+  }
+
+  // Then if we are still successful, AND the AOS error code was good,
+  // save the test results
+  if(success && (DR_ERROR_NO_ERROR == error) )
+  {
+    for(int i = 0; i < num_tests; ++i)
+    {
+      success = save_int_csv(&test_results_file,
+				  (int const)test_results[i]);
+      
+      if(!success)
+      {
+	break;
+      }
+    }
+  }
+
+  // OS_printf("DR: save_test_results(): after saving test results, success = %d\n", success);
+
+  // Finally add the EOL 
+  if(success)
+  {
+    success = save_eol(&test_results_file);
+  }
+
+  // OS_printf("DR: save_test_results(): after save_eol, success = %d\n", success);
+
+  return success;
+}
+
+static bool save_failure_modes(
+  int const iteration,
+  dr_error_type const error,
+  int const num_failure_modes,
+  dr_failure_mode_type const failure_modes[num_failure_modes])
+{
+  // First write the iteration and AOS error code
+  bool success = save_int_csv(&failure_modes_file, iteration);
+
+  if(success)
+  {
+    success = save_int_csv(&failure_modes_file, (int const)error);
+  }
+
+  // OS_printf("DR: save_failure_modes(): success = %d\n", success);
+
+  // Then if we are still successful, AND the AOS error code was good,
+  // save the failure modes
+  if(success && (DR_ERROR_NO_ERROR == error) )
+  {
+    for(int i = 0; i < num_failure_modes; ++i)
+    {
+      success = save_int_csv(&failure_modes_file,
+				  (int const)failure_modes[i]);
+      
+      if(!success)
+      {
+	break;
+      }
+    }
+  }
+
+  // Finally add the EOL 
+  if(success)
+  {
+    success = save_eol(&failure_modes_file);
+  }
+
+  return success;
+}
+
+static bool save_int_csv(results_file_type * const file, int const value)
+{
+  // Make room for the value first
+  bool success = true;
+
+  if( (file->num_bytes + MAX_INT_CSV_LENGTH) > sizeof(file->buffer) )
+  {
+    success = flush_results_file(file);
+  }
+
+  // Format the value, as "%d, " would
+  if(success)
+  {
+    char * const text = &file->buffer[file->num_bytes];
+    uint32 length = format_int(text, value);
+    text[length++] = ',';
+    text[length++] = ' ';
+    file->num_bytes += length;
+  }
+
+  return success;
+}
+
+static bool save_eol(results_file_type * const file)
+{
+  bool success = true;
+
+  if( (file->num_bytes + 1) > sizeof(file->buffer) )
+  {
+    success = flush_results_file(file);
+  }
+
+  if(success)
+  {
+    file->buffer[file->num_bytes++] = '\n';
+    file->num_rows++;
+
+    if(file->num_rows >= DR_RESULTS_FLUSH_ROWS)
+    {
+      success = flush_results_file(file);
+    }
+  }
+  
+  return success;
+}
+
+static bool flush_results_file(results_file_type * const file)
+{
+  bool success = true;
+
+  if(file->num_bytes > 0)
+  {
+    int32 os_code = OS_write(file->filedes, file->buffer, file->num_bytes);
+    
+    if(os_code != (int32)file->num_bytes) // OS errors are all < 0. 
+    {
+      success = false;
+    }
+  }
+
+  // What couldn't be written is dropped, so the next rows still fit
+  file->num_bytes = 0;
+  file->num_rows = 0;
+  
+  return success;
+}
+
+static bool make_room(results_file_type * const file, uint32 const size)
+{
+  // Write out what is buffered if the size doesn't fit after it. A size
+  // bigger than the whole buffer never fits.
+  bool success = true;
+
+  if( (file->num_bytes + size) > sizeof(file->buffer) )
+  {
+    success = flush_results_file(file);
+  }
+
+  return success && (size <= sizeof(file->buffer));
+}
+
+static uint32 format_int(char * const text, int const value)
+{
+  // Write the digits backwards into a scratch buffer, then copy them
+  // out in order. The magnitude is taken unsigned, so the most negative
+  // int works too.
+  char digits[MAX_INT_CSV_LENGTH];
+  uint32 num_digits = 0;
+  unsigned int magnitude = (value < 0) ?
+    (0u - (unsigned int)value) : (unsigned int)value;
+
+  do
+  {
+    digits[num_digits++] = (char)('0' + (magnitude % 10u));
+    magnitude /= 10u;
+  }
+  while(magnitude > 0);
+
+  uint32 length = 0;
+  if(value < 0)
+  {
+    text[length++] = '-';
+  }
+
+  while(num_digits > 0)
+  {
+    text[length++] = digits[--num_digits];
+  }
+
+  return length;
+}
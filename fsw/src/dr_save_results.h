@@ -1,40 +1,73 @@
-#ifndef DR_SAVE_RESULTS_H
-#define DR_SAVE_RESULTS_H
-
-#include "dr_types.h"
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-////////////////////////////////////////////////////////////////////////
-// Public Functions
-////////////////////////////////////////////////////////////////////////
-
-/// Open the csv files 
-dr_error_type dr_open_results_files(
-  char const * const test_results_filename,
-  char const * const failure_modes_filename);
-  
-// Close the csv files
-dr_error_type dr_close_results_files(void);
-  
-  
-///
-// Saves the diagnosis results to csv files. Will use the OSAL
-// file management functions.
-//
-dr_error_type dr_save_results(
-  int const iteration,
-  dr_error_type const error,
-  int const num_tests,
-  dr_test_result_type const test_results[num_tests],
-  int const num_failure_modes,
-  dr_failure_mode_type const failure_modes[num_failure_modes]
-  );
-  
-#ifdef __cplusplus
-} // extern "C" {
-#endif
-
-#endif // DR_SAVE_RESULTS_H
+#ifndef DR_SAVE_RESULTS_H
+#define DR_SAVE_RESULTS_H
+
+#include "dr_types.h"
+#include "dr_log_format.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////
+
+/// Open the csv files 
+dr_error_type dr_open_results_files(
+  char const * const test_results_filename,
+  char const * const failure_modes_filename);
+  
+// Close the csv files
+dr_error_type dr_close_results_files(void);
+  
+  
+///
+// Saves the diagnosis results to csv files. Will use the OSAL
+// file management functions.
+//
+dr_error_type dr_save_results(
+  int const iteration,
+  dr_error_type const error,
+  int const num_tests,
+  dr_test_result_type const test_results[num_tests],
+  int const num_failure_modes,
+  dr_failure_mode_type const failure_modes[num_failure_modes]
+  );
+
+/// Open the binary diagnosis log, in the format of dr_log_format.h
+dr_error_type dr_open_results_log(char const * const log_filename);
+
+// Close the binary diagnosis log
+dr_error_type dr_close_results_log(void);
+
+///
+// Starts a new segment of the binary diagnosis log. The magic number,
+// version and sizes of the header are filled in here, the rest is the
+// caller's. The records saved after it must be of the header's model
+// size.
+//
+dr_error_type dr_save_results_log_header(
+  dr_log_header_type const * const header);
+
+///
+// Saves the diagnosis results as a record of the binary diagnosis log,
+// with the cFE time of the diagnosis. The record is a keyframe or a
+// delta of the results of the record before, as
+// DR_RESULTS_KEYFRAME_INTERVAL says.
+//
+dr_error_type dr_save_results_log(
+  int const iteration,
+  uint32_t const seconds,
+  uint32_t const subseconds,
+  dr_error_type const error,
+  int const num_tests,
+  dr_test_result_type const test_results[num_tests],
+  int const num_failure_modes,
+  dr_failure_mode_type const failure_modes[num_failure_modes]
+  );
+  
+#ifdef __cplusplus
+} // extern "C" {
+#endif
+
+#endif // DR_SAVE_RESULTS_H
@@ -0,0 +1,228 @@
+
+#include "dr_sliced_d_matrix.h"
+
+#include <string.h>
+
+#include "dr_process_d_matrix.h"
+
+////////////////////////////////////////////////////////////////
+// Private function prototypes
+////////////////////////////////////////////////////////////////
+
+/// Returns a word with the bits of the lanes in use set.
+/// @param [in] num_lanes The number of lanes in use, from 1 to DR_SLICED_LANES
+static dr_bitset_word_type lane_mask(uint32_t const num_lanes);
+
+/// Returns the OR of the planes of the set bits of a row or column.
+/// @param [in] bits The row or column bitset
+/// @param [in] num_words The number of words in the bitset
+/// @param [in] planes The plane of each bit of the bitset
+static dr_bitset_word_type or_planes(dr_bitset_word_type const bits[],
+                                     uint32_t const num_words,
+                                     dr_bitset_word_type const planes[]);
+
+/////////////////////////////////////////////////////////////////
+// Public function definitions
+/////////////////////////////////////////////////////////////////
+
+void dr_slice_test_results(uint32_t const num_lanes,
+                           uint32_t const num_tests,
+                           dr_test_result_type const test_results[num_lanes][num_tests],
+                           dr_sliced_planes_type * const planes)
+{
+  planes->num_lanes = num_lanes;
+  memset(planes->passed, 0, sizeof(dr_bitset_word_type) * num_tests);
+  memset(planes->failed, 0, sizeof(dr_bitset_word_type) * num_tests);
+
+  // Read each vector straight through, setting its lane in each plane
+  for (uint32_t v = 0; v < num_lanes; ++v)
+  {
+    dr_bitset_word_type const lane = (dr_bitset_word_type)1 << v;
+
+    for (uint32_t j = 0; j < num_tests; ++j)
+    {
+      if (DR_TEST_RESULT_PASS == test_results[v][j])
+      {
+        planes->passed[j] |= lane;
+      }
+      else if (DR_TEST_RESULT_FAIL == test_results[v][j])
+      {
+        planes->failed[j] |= lane;
+      }
+    }
+  }
+}
+
+void dr_slice_faults(dr_bitset_d_matrix_type const * const bitset,
+                     uint32_t const num_lanes,
+                     dr_bitset_word_type const faults[],
+                     dr_sliced_planes_type * const planes)
+{
+  dr_bitset_word_type const lanes = lane_mask(num_lanes);
+
+  planes->num_lanes = num_lanes;
+
+  for (uint32_t j = 0; j < bitset->num_tests; ++j)
+  {
+    planes->failed[j] = lanes &
+      or_planes(dr_bitset_col(bitset, j), bitset->failure_mode_words, faults);
+    planes->passed[j] = lanes & ~(planes->failed[j]);
+  }
+}
+
+void dr_process_sliced_d_matrix(dr_bitset_d_matrix_type const * const bitset,
+                                dr_sliced_planes_type * const planes)
+{
+  uint32_t const test_words = bitset->test_words;
+  uint32_t const failure_mode_words = bitset->failure_mode_words;
+
+  // First pass. In each lane, a failure mode implicated by a passing
+  // test is good, otherwise one implicated by a failing test is
+  // suspect, and otherwise it is unknown.
+  for (uint32_t i = 0; i < bitset->num_failure_modes; ++i)
+  {
+    dr_bitset_word_type const * const row = dr_bitset_row(bitset, i);
+
+    planes->good[i] = or_planes(row, test_words, planes->passed);
+    planes->suspect[i] = or_planes(row, test_words, planes->failed) &
+      ~(planes->good[i]);
+  }
+
+  // Second pass. Find the failed tests that implicate exactly one
+  // suspect, counting the suspects of each lane to two with a pair of
+  // planes: those seen at least once, and those seen at least twice.
+  for (uint32_t j = 0; j < bitset->num_tests; ++j)
+  {
+    dr_bitset_word_type const * const col = dr_bitset_col(bitset, j);
+    dr_bitset_word_type once = 0;
+    dr_bitset_word_type twice = 0;
+
+    for (uint32_t w = 0; (w < failure_mode_words) && (0 != planes->failed[j]); ++w)
+    {
+      dr_bitset_word_type word = col[w];
+      while (0 != word)
+      {
+        uint32_t const i = (w * DR_BITSET_WORD_BITS) + dr_bitset_lowest_bit(word);
+        word &= word - 1;
+
+        twice |= once & planes->suspect[i];
+        once |= planes->suspect[i];
+      }
+    }
+
+    planes->singles[j] = planes->failed[j] & once & ~twice;
+  }
+
+  // A suspect is bad if it is implicated by one of those tests.
+  for (uint32_t i = 0; i < bitset->num_failure_modes; ++i)
+  {
+    planes->bad[i] = planes->suspect[i] &
+      or_planes(dr_bitset_row(bitset, i), test_words, planes->singles);
+    planes->suspect[i] &= ~(planes->bad[i]);
+  }
+}
+
+void dr_unslice_failure_modes(dr_sliced_planes_type const * const planes,
+                              uint32_t const num_failure_modes,
+                              dr_failure_mode_type failure_modes[][num_failure_modes])
+{
+  // Write each vector straight through, reading its lane of each plane
+  for (uint32_t v = 0; v < planes->num_lanes; ++v)
+  {
+    for (uint32_t i = 0; i < num_failure_modes; ++i)
+    {
+      dr_failure_mode_type value = DR_FAILURE_MODE_UNKNOWN;
+
+      if (0 != ((planes->good[i] >> v) & 1U))
+      {
+        value = DR_FAILURE_MODE_GOOD;
+      }
+      else if (0 != ((planes->suspect[i] >> v) & 1U))
+      {
+        value = DR_FAILURE_MODE_SUSPECT;
+      }
+      else if (0 != ((planes->bad[i] >> v) & 1U))
+      {
+        value = DR_FAILURE_MODE_BAD;
+      }
+
+      failure_modes[v][i] = value;
+    }
+  }
+}
+
+dr_error_type dr_process_sliced_d_matrix_batch(
+  dr_bitset_d_matrix_type const * const bitset,
+  dr_sliced_planes_type * const planes,
+  uint32_t const num_vectors,
+  uint32_t const num_tests,
+  dr_test_result_type const test_results[num_vectors][num_tests],
+  uint32_t const num_failure_modes,
+  dr_failure_mode_type failure_modes[num_vectors][num_failure_modes])
+{
+  dr_error_type error = DR_ERROR_NO_ERROR;
+
+  // Check every vector before solving any, as in
+  // dr_process_bitset_d_matrix_batch().
+  if (num_tests != bitset->num_tests)
+  {
+    error = DR_ERROR_WRONG_NUM_TESTS;
+  }
+  else if (num_failure_modes != bitset->num_failure_modes)
+  {
+    error = DR_ERROR_WRONG_NUM_FAILURE_MODES;
+  }
+
+  for (uint32_t v = 0; (v < num_vectors) && (DR_ERROR_NO_ERROR == error); ++v)
+  {
+    error = dr_check_test_results(num_tests, test_results[v]);
+  }
+
+  if (DR_ERROR_NO_ERROR == error)
+  {
+    for (uint32_t first = 0; first < num_vectors; first += DR_SLICED_LANES)
+    {
+      uint32_t const num_lanes =
+        ((num_vectors - first) < DR_SLICED_LANES) ?
+        (num_vectors - first) : DR_SLICED_LANES;
+
+      dr_slice_test_results(num_lanes, num_tests, &(test_results[first]),
+                            planes);
+      dr_process_sliced_d_matrix(bitset, planes);
+      dr_unslice_failure_modes(planes, num_failure_modes,
+                               &(failure_modes[first]));
+    }
+  }
+
+  return error;
+}
+
+////////////////////////////////////////////////////////////////
+// Private function definitions
+////////////////////////////////////////////////////////////////
+
+dr_bitset_word_type lane_mask(uint32_t const num_lanes)
+{
+  return (num_lanes >= DR_SLICED_LANES) ?
+    ~(dr_bitset_word_type)0 :
+    (((dr_bitset_word_type)1 << num_lanes) - 1);
+}
+
+dr_bitset_word_type or_planes(dr_bitset_word_type const bits[],
+                              uint32_t const num_words,
+                              dr_bitset_word_type const planes[])
+{
+  dr_bitset_word_type any = 0;
+
+  for (uint32_t w = 0; w < num_words; ++w)
+  {
+    dr_bitset_word_type word = bits[w];
+    while (0 != word)
+    {
+      any |= planes[(w * DR_BITSET_WORD_BITS) + dr_bitset_lowest_bit(word)];
+      word &= word - 1;
+    }
+  }
+
+  return any;
+}
@@ -0,0 +1,115 @@
+#ifndef DR_SLICED_D_MATRIX_H
+#define DR_SLICED_D_MATRIX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dr_types.h"
+#include "dr_bitset_d_matrix.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The number of scenarios solved at once by the bit-sliced solver, one
+/// per bit lane of a bitset word.
+#define DR_SLICED_LANES DR_BITSET_WORD_BITS
+
+/// The bit planes of the bit-sliced solver. Each word holds one test or
+/// failure mode for DR_SLICED_LANES independent scenarios, with bit v
+/// of every word belonging to scenario v, so each word operation works
+/// on every scenario at once. Large, so meant to be kept off the stack.
+typedef struct
+{
+  /// The number of scenarios in use, from 1 to DR_SLICED_LANES.
+  uint32_t num_lanes;
+
+  /// Bit v of passed[j] is set if test j passed in scenario v.
+  dr_bitset_word_type passed[DR_MAX_MODEL_TESTS];
+
+  /// Bit v of failed[j] is set if test j failed in scenario v. A test
+  /// neither passed nor failed is unknown.
+  dr_bitset_word_type failed[DR_MAX_MODEL_TESTS];
+
+  /// Bit v of singles[j] is set if test j failed and implicates exactly
+  /// one suspect in scenario v.
+  dr_bitset_word_type singles[DR_MAX_MODEL_TESTS];
+
+  /// Bit v of good[i] is set if failure mode i is good in scenario v.
+  dr_bitset_word_type good[DR_MAX_MODEL_FAILURE_MODES];
+
+  /// Bit v of suspect[i] is set if failure mode i is suspect in
+  /// scenario v. A failure mode neither good, suspect nor bad is unknown.
+  dr_bitset_word_type suspect[DR_MAX_MODEL_FAILURE_MODES];
+
+  /// Bit v of bad[i] is set if failure mode i is bad in scenario v.
+  dr_bitset_word_type bad[DR_MAX_MODEL_FAILURE_MODES];
+
+} dr_sliced_planes_type;
+
+/// Encodes up to DR_SLICED_LANES test result vectors into the pass and
+/// fail planes, vector v into lane v.
+/// @param [in] num_lanes The number of test result vectors, from 1 to DR_SLICED_LANES
+/// @param [in] num_tests The number of tests in each test results vector
+/// @param [in] test_results The test result vectors, already checked
+/// @param [out] planes The planes to encode into
+void dr_slice_test_results(uint32_t const num_lanes,
+                           uint32_t const num_tests,
+                           dr_test_result_type const test_results[num_lanes][num_tests],
+                           dr_sliced_planes_type * const planes);
+
+/// Sets the pass and fail planes for a fault injection campaign, where
+/// each lane is a scenario with a set of failure modes faulted. A test
+/// fails if it implicates a faulted failure mode, and passes otherwise.
+/// @param [in] bitset The compiled d-matrix
+/// @param [in] num_lanes The number of scenarios, from 1 to DR_SLICED_LANES
+/// @param [in] faults Bit v of faults[i] is set if failure mode i is faulted in scenario v
+/// @param [out] planes The planes to encode into
+void dr_slice_faults(dr_bitset_d_matrix_type const * const bitset,
+                     uint32_t const num_lanes,
+                     dr_bitset_word_type const faults[],
+                     dr_sliced_planes_type * const planes);
+
+/// Solves a compiled d-matrix for every scenario of the pass and fail
+/// planes at once, leaving the failure modes in the good, suspect and
+/// bad planes. Each scenario gives the same failure modes as
+/// dr_process_d_matrix() would for its test results.
+/// @param [in] bitset The compiled d-matrix to solve
+/// @param [inout] planes The planes, with the pass and fail planes set
+void dr_process_sliced_d_matrix(dr_bitset_d_matrix_type const * const bitset,
+                                dr_sliced_planes_type * const planes);
+
+/// Decodes the failure modes of every lane of the planes, lane v into
+/// failure modes vector v.
+/// @param [in] planes The planes, solved by dr_process_sliced_d_matrix()
+/// @param [in] num_failure_modes The number of failure modes in each failure modes vector
+/// @param [out] failure_modes The failure mode vectors, one per lane
+void dr_unslice_failure_modes(dr_sliced_planes_type const * const planes,
+                              uint32_t const num_failure_modes,
+                              dr_failure_mode_type failure_modes[][num_failure_modes]);
+
+/// Same as dr_process_bitset_d_matrix_batch(), but solves the vectors
+/// DR_SLICED_LANES at a time with the bit-sliced solver, which visits
+/// each d-matrix entry once per DR_SLICED_LANES vectors.
+/// @param [in] bitset The compiled d-matrix to solve
+/// @param [inout] planes Scratch planes for the solver
+/// @param [in] num_vectors The number of test result vectors
+/// @param [in] num_tests  The number of tests in each test results vector
+/// @param [in] test_results The given test result vectors
+/// @param [in] num_failure_modes The number of failure modes in each failure modes vector
+/// @param [out] failure_modes The returned failure modes, one vector per test results vector
+dr_error_type dr_process_sliced_d_matrix_batch(
+  dr_bitset_d_matrix_type const * const bitset,
+  dr_sliced_planes_type * const planes,
+  uint32_t const num_vectors,
+  uint32_t const num_tests,
+  dr_test_result_type const test_results[num_vectors][num_tests],
+  uint32_t const num_failure_modes,
+  dr_failure_mode_type failure_modes[num_vectors][num_failure_modes]);
+
+#ifdef __cplusplus
+} // extern "C" {
+#endif
+
+
+#endif // DR_SLICED_D_MATRIX_H
@@ -0,0 +1,257 @@
+
+#include "dr_sparse_d_matrix.h"
+
+#include <string.h>
+
+#include "dr_process_d_matrix.h"
+
+////////////////////////////////////////////////////////////////
+// Private function prototypes
+////////////////////////////////////////////////////////////////
+
+/// Empties the sparse d-matrix, leaving it with no tests, failure modes,
+/// or entries.
+/// @param [inout] sparse The sparse d-matrix to empty
+static void clear_sparse_d_matrix(dr_sparse_d_matrix_type * const sparse);
+
+/////////////////////////////////////////////////////////////////
+// Public function definitions
+/////////////////////////////////////////////////////////////////
+
+void dr_init_sparse_d_matrix(dr_sparse_d_matrix_type * const sparse,
+                             dr_sparse_offset_type * const row_starts,
+                             dr_sparse_index_type * const row_tests,
+                             dr_sparse_offset_type * const col_starts,
+                             dr_sparse_index_type * const col_failure_modes,
+                             uint32_t const max_tests,
+                             uint32_t const max_failure_modes,
+                             uint32_t const max_nonzeros)
+{
+  memset(sparse, 0, sizeof(*sparse));
+
+  sparse->max_tests = max_tests;
+  sparse->max_failure_modes = max_failure_modes;
+  sparse->max_nonzeros = max_nonzeros;
+  sparse->row_starts = row_starts;
+  sparse->row_tests = row_tests;
+  sparse->col_starts = col_starts;
+  sparse->col_failure_modes = col_failure_modes;
+
+  clear_sparse_d_matrix(sparse);
+}
+
+dr_error_type dr_compile_sparse_d_matrix(dr_bitset_d_matrix_type const * const bitset,
+                                         dr_sparse_d_matrix_type * const sparse)
+{
+  dr_error_type error = DR_ERROR_NO_ERROR;
+
+  // Count the entries first, so a d-matrix that doesn't fit is rejected
+  // before anything is written.
+  uint32_t num_nonzeros = 0;
+  for (uint32_t i = 0; i < bitset->num_failure_modes; ++i)
+  {
+    dr_bitset_word_type const * const row = dr_bitset_row(bitset, i);
+    for (uint32_t w = 0; w < bitset->test_words; ++w)
+    {
+      num_nonzeros += dr_bitset_popcount(row[w]);
+    }
+  }
+
+  if (bitset->num_tests > sparse->max_tests)
+  {
+    error = DR_ERROR_WRONG_NUM_TESTS;
+  }
+  else if (bitset->num_failure_modes > sparse->max_failure_modes)
+  {
+    error = DR_ERROR_WRONG_NUM_FAILURE_MODES;
+  }
+  else if (num_nonzeros > sparse->max_nonzeros)
+  {
+    error = DR_ERROR_TOO_MANY_NONZEROS;
+  }
+
+  if (DR_ERROR_NO_ERROR != error)
+  {
+    clear_sparse_d_matrix(sparse);
+  }
+  else
+  {
+    sparse->num_tests = bitset->num_tests;
+    sparse->num_failure_modes = bitset->num_failure_modes;
+    sparse->num_nonzeros = num_nonzeros;
+
+    // Walking the set bits of each row and column gives the indices
+    // already in increasing order.
+    dr_sparse_offset_type offset = 0;
+    for (uint32_t i = 0; i < bitset->num_failure_modes; ++i)
+    {
+      dr_bitset_word_type const * const row = dr_bitset_row(bitset, i);
+      sparse->row_starts[i] = offset;
+
+      for (uint32_t w = 0; w < bitset->test_words; ++w)
+      {
+        dr_bitset_word_type word = row[w];
+        while (0 != word)
+        {
+          sparse->row_tests[offset++] = (dr_sparse_index_type)
+            ((w * DR_BITSET_WORD_BITS) + dr_bitset_lowest_bit(word));
+          word &= word - 1;
+        }
+      }
+    }
+    sparse->row_starts[bitset->num_failure_modes] = offset;
+
+    offset = 0;
+    for (uint32_t j = 0; j < bitset->num_tests; ++j)
+    {
+      dr_bitset_word_type const * const col = dr_bitset_col(bitset, j);
+      sparse->col_starts[j] = offset;
+
+      for (uint32_t w = 0; w < bitset->failure_mode_words; ++w)
+      {
+        dr_bitset_word_type word = col[w];
+        while (0 != word)
+        {
+          sparse->col_failure_modes[offset++] = (dr_sparse_index_type)
+            ((w * DR_BITSET_WORD_BITS) + dr_bitset_lowest_bit(word));
+          word &= word - 1;
+        }
+      }
+    }
+    sparse->col_starts[bitset->num_tests] = offset;
+  }
+
+  return error;
+}
+
+dr_error_type dr_process_sparse_d_matrix(dr_sparse_d_matrix_type const * const sparse,
+                                         uint32_t const num_tests,
+                                         dr_test_result_type const test_results[num_tests],
+                                         uint32_t const num_failure_modes,
+                                         dr_failure_mode_type failure_modes[num_failure_modes])
+{
+  dr_error_type error = DR_ERROR_NO_ERROR;
+
+  // Check the arguments in the same order as dr_process_d_matrix().
+  if (num_tests != sparse->num_tests)
+  {
+    error = DR_ERROR_WRONG_NUM_TESTS;
+  }
+  else if (num_failure_modes != sparse->num_failure_modes)
+  {
+    error = DR_ERROR_WRONG_NUM_FAILURE_MODES;
+  }
+  else
+  {
+    error = dr_check_test_results(num_tests, test_results);
+  }
+
+  if (DR_ERROR_NO_ERROR == error)
+  {
+    // First pass, over the tests that implicate each failure mode.
+    for (uint32_t i = 0; i < num_failure_modes; ++i)
+    {
+      failure_modes[i] = dr_sparse_first_pass(sparse, i, test_results);
+    }
+
+    // Second pass. The set of failure modes that are suspect or bad
+    // does not change while suspects are promoted to bad, so find the
+    // failed tests implicating exactly one suspect once.
+    bool single[DR_MAX_MODEL_TESTS];
+
+    for (uint32_t j = 0; j < num_tests; ++j)
+    {
+      single[j] = dr_sparse_is_single(sparse, j, test_results, failure_modes);
+    }
+
+    // A suspect is bad if it is implicated by one of those tests.
+    for (uint32_t i = 0; i < num_failure_modes; ++i)
+    {
+      if ( (DR_FAILURE_MODE_SUSPECT == failure_modes[i]) &&
+           dr_sparse_is_bad(sparse, i, single) )
+      {
+        failure_modes[i] = DR_FAILURE_MODE_BAD;
+      }
+    }
+  }
+
+  return error;
+}
+
+dr_failure_mode_type dr_sparse_first_pass(dr_sparse_d_matrix_type const * const sparse,
+                                          uint32_t const failure_mode_index,
+                                          dr_test_result_type const test_results[])
+{
+  dr_failure_mode_type value = DR_FAILURE_MODE_UNKNOWN;
+
+  for (dr_sparse_offset_type k = sparse->row_starts[failure_mode_index];
+       k < sparse->row_starts[failure_mode_index + 1]; ++k)
+  {
+    dr_test_result_type const test_result = test_results[sparse->row_tests[k]];
+
+    if (DR_TEST_RESULT_PASS == test_result)
+    {
+      // Any passing test makes the failure mode good
+      value = DR_FAILURE_MODE_GOOD;
+      break;
+    }
+    else if (DR_TEST_RESULT_FAIL == test_result)
+    {
+      value = DR_FAILURE_MODE_SUSPECT;
+    }
+  }
+
+  return value;
+}
+
+bool dr_sparse_is_single(dr_sparse_d_matrix_type const * const sparse,
+                         uint32_t const test_index,
+                         dr_test_result_type const test_results[],
+                         dr_failure_mode_type const failure_modes[])
+{
+  uint32_t count = 0;
+
+  if (DR_TEST_RESULT_FAIL == test_results[test_index])
+  {
+    for (dr_sparse_offset_type k = sparse->col_starts[test_index];
+         (k < sparse->col_starts[test_index + 1]) && (count < 2); ++k)
+    {
+      if (DR_FAILURE_MODE_SUSPECT ==
+          failure_modes[sparse->col_failure_modes[k]])
+      {
+        ++count;
+      }
+    }
+  }
+
+  return (1 == count);
+}
+
+bool dr_sparse_is_bad(dr_sparse_d_matrix_type const * const sparse,
+                      uint32_t const failure_mode_index,
+                      bool const single[])
+{
+  bool is_bad = false;
+
+  for (dr_sparse_offset_type k = sparse->row_starts[failure_mode_index];
+       (k < sparse->row_starts[failure_mode_index + 1]) && !is_bad; ++k)
+  {
+    is_bad = single[sparse->row_tests[k]];
+  }
+
+  return is_bad;
+}
+
+////////////////////////////////////////////////////////////////
+// Private function definitions
+////////////////////////////////////////////////////////////////
+
+void clear_sparse_d_matrix(dr_sparse_d_matrix_type * const sparse)
+{
+  sparse->num_tests = 0;
+  sparse->num_failure_modes = 0;
+  sparse->num_nonzeros = 0;
+  sparse->row_starts[0] = 0;
+  sparse->col_starts[0] = 0;
+}
+
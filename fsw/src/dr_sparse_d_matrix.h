@@ -0,0 +1,143 @@
+#ifndef DR_SPARSE_D_MATRIX_H
+#define DR_SPARSE_D_MATRIX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dr_types.h"
+#include "dr_bitset_d_matrix.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The type of a test or failure mode index in the sparse d-matrix.
+/// Both DR_MAX_MODEL_TESTS and DR_MAX_MODEL_FAILURE_MODES fit.
+typedef uint16_t dr_sparse_index_type;
+
+/// The type of an offset into the index arrays of the sparse d-matrix.
+typedef uint32_t dr_sparse_offset_type;
+
+/// A D-matrix compressed to just its entries that are set, both by row
+/// (CSR) and by column (CSC), built once when the d-matrix table is
+/// loaded. Each failure mode lists the tests that implicate it, and
+/// each test lists the failure modes it implicates, so the solver only
+/// visits the entries that are set.
+///
+/// The arrays live in storage given to dr_init_sparse_d_matrix(), which
+/// fixes the largest d-matrix that may be compiled into it.
+typedef struct
+{
+  /// The number of tests in the compiled d-matrix.
+  uint32_t num_tests;
+
+  /// The number of failure modes in the compiled d-matrix.
+  uint32_t num_failure_modes;
+
+  /// The number of entries set in the compiled d-matrix.
+  uint32_t num_nonzeros;
+
+  /// The largest number of tests the storage can hold.
+  uint32_t max_tests;
+
+  /// The largest number of failure modes the storage can hold.
+  uint32_t max_failure_modes;
+
+  /// The largest number of entries set the storage can hold.
+  uint32_t max_nonzeros;
+
+  /// The tests implicating failure mode i are row_tests[row_starts[i]]
+  /// up to but not including row_tests[row_starts[i + 1]]. Has
+  /// num_failure_modes + 1 entries.
+  dr_sparse_offset_type * row_starts;
+
+  /// The tests of each row, in increasing order.
+  dr_sparse_index_type * row_tests;
+
+  /// The failure modes implicated by test j are
+  /// col_failure_modes[col_starts[j]] up to but not including
+  /// col_failure_modes[col_starts[j + 1]]. Has num_tests + 1 entries.
+  dr_sparse_offset_type * col_starts;
+
+  /// The failure modes of each column, in increasing order.
+  dr_sparse_index_type * col_failure_modes;
+
+} dr_sparse_d_matrix_type;
+
+/// Gives storage to a sparse d-matrix, and leaves it empty.
+/// @param [out] sparse The sparse d-matrix to initialize
+/// @param [in] row_starts At least max_failure_modes + 1 offsets
+/// @param [in] row_tests At least max_nonzeros indices
+/// @param [in] col_starts At least max_tests + 1 offsets
+/// @param [in] col_failure_modes At least max_nonzeros indices
+/// @param [in] max_tests The largest number of tests that may be compiled
+/// @param [in] max_failure_modes The largest number of failure modes that may be compiled
+/// @param [in] max_nonzeros The largest number of entries set that may be compiled
+void dr_init_sparse_d_matrix(dr_sparse_d_matrix_type * const sparse,
+                             dr_sparse_offset_type * const row_starts,
+                             dr_sparse_index_type * const row_tests,
+                             dr_sparse_offset_type * const col_starts,
+                             dr_sparse_index_type * const col_failure_modes,
+                             uint32_t const max_tests,
+                             uint32_t const max_failure_modes,
+                             uint32_t const max_nonzeros);
+
+/// Compresses a d-matrix already compiled into bitsets. This is meant
+/// to be called once each time the d-matrix table is loaded, right
+/// after the bitsets are compiled. If an error is returned the sparse
+/// d-matrix is left empty.
+/// @param [in] bitset The compiled d-matrix
+/// @param [inout] sparse The sparse d-matrix, already given storage
+/// @return DR_ERROR_WRONG_NUM_TESTS, DR_ERROR_WRONG_NUM_FAILURE_MODES or DR_ERROR_TOO_MANY_NONZEROS if the d-matrix doesn't fit
+dr_error_type dr_compile_sparse_d_matrix(dr_bitset_d_matrix_type const * const bitset,
+                                         dr_sparse_d_matrix_type * const sparse);
+
+/// Solves a sparse d-matrix for the given test results, visiting only
+/// the entries that are set. Gives exactly the same failure modes and
+/// errors as dr_process_d_matrix() on the table it was compiled from.
+/// @param [in] sparse The sparse d-matrix to solve
+/// @param [in] num_tests  The number of tests in the test results array
+/// @param [in] test_results The given test results
+/// @param [in] num_failure_modes The number of failure modes in the failure_modes array
+/// @param [out] failure_modes The returned failure modes from processing the d-matrix
+dr_error_type dr_process_sparse_d_matrix(dr_sparse_d_matrix_type const * const sparse,
+                                         uint32_t const num_tests,
+                                         dr_test_result_type const test_results[num_tests],
+                                         uint32_t const num_failure_modes,
+                                         dr_failure_mode_type failure_modes[num_failure_modes]);
+
+/// Returns the good, suspect, or unknown value of a failure mode from
+/// the first pass, visiting only the tests that implicate it.
+/// @param [in] sparse The sparse d-matrix
+/// @param [in] failure_mode_index The failure mode to evaluate
+/// @param [in] test_results The given test results, already checked
+dr_failure_mode_type dr_sparse_first_pass(dr_sparse_d_matrix_type const * const sparse,
+                                          uint32_t const failure_mode_index,
+                                          dr_test_result_type const test_results[]);
+
+/// Returns true if the given test failed and implicates exactly one
+/// failure mode that is suspect after the first pass.
+/// @param [in] sparse The sparse d-matrix
+/// @param [in] test_index The test to evaluate
+/// @param [in] test_results The given test results, already checked
+/// @param [in] failure_modes The failure modes after the first pass
+bool dr_sparse_is_single(dr_sparse_d_matrix_type const * const sparse,
+                         uint32_t const test_index,
+                         dr_test_result_type const test_results[],
+                         dr_failure_mode_type const failure_modes[]);
+
+/// Returns true if a suspect failure mode is implicated by one of the
+/// single implication tests, so is bad.
+/// @param [in] sparse The sparse d-matrix
+/// @param [in] failure_mode_index The suspect failure mode to evaluate
+/// @param [in] single Whether each test is a single implication test
+bool dr_sparse_is_bad(dr_sparse_d_matrix_type const * const sparse,
+                      uint32_t const failure_mode_index,
+                      bool const single[]);
+
+#ifdef __cplusplus
+} // extern "C" {
+#endif
+
+
+#endif // DR_SPARSE_D_MATRIX_H
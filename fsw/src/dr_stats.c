@@ -0,0 +1,49 @@
+
+#include "dr_stats.h"
+
+#include <string.h>
+
+/////////////////////////////////////////////////////////////////
+// Public function definitions
+/////////////////////////////////////////////////////////////////
+
+void dr_reset_stats(dr_stats_type * const stats)
+{
+  memset(stats, 0, sizeof(*stats));
+}
+
+void dr_record_stats(dr_stats_type * const stats, uint32_t const usec)
+{
+  if ( (0 == stats->count) || (usec < stats->min_usec) )
+  {
+    stats->min_usec = usec;
+  }
+  if (usec > stats->max_usec)
+  {
+    stats->max_usec = usec;
+  }
+
+  // The count only wraps after years of wakeups, but must not divide
+  // by zero when it does.
+  stats->count++;
+  stats->last_usec = usec;
+  stats->total_usec += usec;
+  if (0 != stats->count)
+  {
+    stats->mean_usec = (uint32_t)(stats->total_usec / stats->count);
+  }
+  stats->histogram[dr_stats_histogram_bin(usec)]++;
+}
+
+uint32_t dr_stats_histogram_bin(uint32_t const usec)
+{
+  // The bin is the position of the highest bit set, so 0 and 1 both go
+  // in bin 0.
+  uint32_t bin = 0;
+  for (uint32_t rest = usec >> 1; rest != 0; rest >>= 1)
+  {
+    ++bin;
+  }
+
+  return (bin < DR_STATS_HISTOGRAM_BINS) ? bin : (DR_STATS_HISTOGRAM_BINS - 1);
+}
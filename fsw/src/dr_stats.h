@@ -0,0 +1,75 @@
+#ifndef DR_STATS_H
+#define DR_STATS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The number of bins of a timing histogram. Bin 0 counts the times
+/// under 2 microseconds, bin k the times from 2^k up to 2^(k+1)
+/// microseconds, and the last bin every time from 2^20 microseconds,
+/// about a second, up. An odd number so dr_stats_type has no padding.
+#define DR_STATS_HISTOGRAM_BINS 21
+
+/// The intervals of a diagnosis wakeup that are timed.
+typedef enum
+{
+  /// Managing the DR tables, including recompiling the model
+  DR_STATS_MANAGE_TABLES = 0,
+  /// Reading the watchpoint results table into test results
+  DR_STATS_GATHER,
+  /// Solving the d-matrix
+  DR_STATS_SOLVE,
+  /// Sending the diagnosis message
+  DR_STATS_PUBLISH,
+  /// Writing the results files
+  DR_STATS_SAVE,
+  /// From receiving the wakeup message to sending the diagnosis message
+  DR_STATS_WAKEUP_TO_PUBLISH,
+  /// The number of timed intervals
+  DR_STATS_STAGE_COUNT
+} dr_stats_stage_type;
+
+/// The timing statistics of one interval, in microseconds. Cheap enough
+/// to keep on every wakeup: recording a time is a handful of adds and
+/// compares.
+typedef struct
+{
+  /// The sum of the times recorded, for the mean
+  uint64_t total_usec;
+  /// The number of times recorded since the last reset
+  uint32_t count;
+  /// The last time recorded
+  uint32_t last_usec;
+  /// The shortest time recorded, or 0 if none were
+  uint32_t min_usec;
+  /// The longest time recorded
+  uint32_t max_usec;
+  /// The mean of the times recorded, rounded down
+  uint32_t mean_usec;
+  /// The times recorded, counted by log-scale bin
+  uint32_t histogram[DR_STATS_HISTOGRAM_BINS];
+} dr_stats_type;
+
+/// Clears the statistics, as if no time had been recorded.
+/// @param [out] stats The statistics to clear
+void dr_reset_stats(dr_stats_type * const stats);
+
+/// Adds one time to the statistics.
+/// @param [inout] stats The statistics to add to
+/// @param [in] usec The time, in microseconds
+void dr_record_stats(dr_stats_type * const stats, uint32_t const usec);
+
+/// Returns the histogram bin that counts the given time.
+/// @param [in] usec The time, in microseconds
+uint32_t dr_stats_histogram_bin(uint32_t const usec);
+
+#ifdef __cplusplus
+} // extern "C" {
+#endif
+
+
+#endif // DR_STATS_H
@@ -1,71 +1,119 @@
-#ifndef DR_TYPES_H
-#define DR_TYPES_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/// Definitions for the maximum numbers of tests and failure modes.
-/// These are used for array sizes in the code, and the d-matrix
-/// table size.
-#define DR_MAX_TESTS 100
-#define DR_MAX_FAILURE_MODES 100
-
-/// Definitions for the errors that can happen internally to DR.
-/// These start in the -40 range in the hope they are more unique,
-/// not as likely to be repeated in other parts of cFS. 
-#define DR_DIAGNOSIS_ERROR                (-40)
-#define DR_WATCHPOINT_TABLE_LOAD_ERROR    (-41)
-#define DR_RESULTS_SAVE_ERROR             (-42)
-#define DR_FILE_OPEN_ERROR                (-43)
-
-/// Enum to define the possible values of a test result.
-typedef enum
-{
-  /// Value for passing tests
-  DR_TEST_RESULT_PASS = 0,
-  /// Value for failing tests
-  DR_TEST_RESULT_FAIL,
-  /// Value for unknown tests
-  DR_TEST_RESULT_UNKNOWN,
-  /// Invalid value, may be used to terminate for-loops
-  DR_TEST_RESULT_COUNT
-} dr_test_result_type;
-
-/// Enum to define the possible values of a failure mode.
-typedef enum
-{
-  /// Value for good failure modes
-  DR_FAILURE_MODE_GOOD = 0,
-  /// Value for suspect failure modes
-  DR_FAILURE_MODE_SUSPECT,
-  /// Value for bad failure modes
-  DR_FAILURE_MODE_BAD,
-  /// Value for unknown failure modes
-  DR_FAILURE_MODE_UNKNOWN,
-  // Invalid value, may be used to terminate for-loops
-  DR_FAILURE_MODE_COUNT
-} dr_failure_mode_type;
-
-/// Enum to define error values for this app.
-typedef enum
-{
-  /// Success code, no error
-  DR_ERROR_NO_ERROR = 0,
-  /// The wrong number of tests was given as an argument
-  DR_ERROR_WRONG_NUM_TESTS,
-  /// The wrong number of failure modes was given as an argument
-  DR_ERROR_WRONG_NUM_FAILURE_MODES,
-  /// A test result given is not valid
-  DR_ERROR_INVALID_TEST_RESULT,
-  /// Unable to open, close, or write to the specified file
-  DR_ERROR_FILE_ERROR,
-  /// Unable to save data to the specified file
-  DR_ERROR_SAVE_ERROR,
-} dr_error_type;
-
-#ifdef __cplusplus
-} // extern "C" {
-#endif
-
-#endif // DR_TYPES_H
+#ifndef DR_TYPES_H
+#define DR_TYPES_H
+
+#include "dr_platform_cfg.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Definitions for the maximum numbers of tests and failure modes.
+/// These are used for array sizes of the fixed-size d-matrix table
+/// type, dr_d_matrix_tbl_type.
+#define DR_MAX_TESTS 100
+#define DR_MAX_FAILURE_MODES 100
+
+/// The maximum numbers of tests, failure modes and d-matrix entries set
+/// of a model loaded at runtime, DR_MAX_MODEL_TESTS,
+/// DR_MAX_MODEL_FAILURE_MODES and DR_MAX_MODEL_NONZEROS, are platform
+/// configuration parameters in dr_platform_cfg.h.
+
+/// Definitions for the errors that can happen internally to DR.
+/// These start in the -40 range in the hope they are more unique,
+/// not as likely to be repeated in other parts of cFS. 
+#define DR_DIAGNOSIS_ERROR                (-40)
+#define DR_WATCHPOINT_TABLE_LOAD_ERROR    (-41)
+#define DR_RESULTS_SAVE_ERROR             (-42)
+#define DR_FILE_OPEN_ERROR                (-43)
+#define DR_TABLE_VALIDATION_ERROR         (-44)
+#define DR_MODEL_ERROR                    (-45)
+
+/// Enum to define the possible values of a test result.
+typedef enum
+{
+  /// Value for passing tests
+  DR_TEST_RESULT_PASS = 0,
+  /// Value for failing tests
+  DR_TEST_RESULT_FAIL,
+  /// Value for unknown tests
+  DR_TEST_RESULT_UNKNOWN,
+  /// Invalid value, may be used to terminate for-loops
+  DR_TEST_RESULT_COUNT
+} dr_test_result_type;
+
+/// Enum to define the possible values of a failure mode.
+typedef enum
+{
+  /// Value for good failure modes
+  DR_FAILURE_MODE_GOOD = 0,
+  /// Value for suspect failure modes
+  DR_FAILURE_MODE_SUSPECT,
+  /// Value for bad failure modes
+  DR_FAILURE_MODE_BAD,
+  /// Value for unknown failure modes
+  DR_FAILURE_MODE_UNKNOWN,
+  // Invalid value, may be used to terminate for-loops
+  DR_FAILURE_MODE_COUNT
+} dr_failure_mode_type;
+
+/// Enum to define the available d-matrix solving engines. They all
+/// give identical failure modes for the same d-matrix and test results,
+/// and differ only in how the work is done. The engines the DR app
+/// supports come first, so a zero-filled mode definition entry gets
+/// DR_ENGINE_INCREMENTAL.
+typedef enum
+{
+  /// The bitset solver, but only recomputing the failure modes affected
+  /// by tests that changed since the last diagnosis,
+  /// dr_process_incremental_d_matrix()
+  DR_ENGINE_INCREMENTAL = 0,
+  /// The solver working on the d-matrix compiled into bitsets,
+  /// dr_process_bitset_d_matrix()
+  DR_ENGINE_BITSET,
+  /// The solver iterating only the entries set in the d-matrix, from
+  /// its compressed rows and columns, dr_process_sparse_d_matrix()
+  DR_ENGINE_SPARSE,
+  /// The sparse solver, but only solving the connected components of
+  /// the d-matrix with tests that changed since the last diagnosis,
+  /// dr_process_component_d_matrix()
+  DR_ENGINE_COMPONENT,
+  /// The original solver, dr_process_d_matrix()
+  DR_ENGINE_REFERENCE,
+  /// The original first pass with the bad pass done from a count of
+  /// implicated suspects per failed test, dr_process_d_matrix_counted()
+  DR_ENGINE_IMPLICATION_COUNT,
+  /// Invalid value, may be used to terminate for-loops
+  DR_ENGINE_COUNT
+} dr_engine_type;
+
+/// Enum to define error values for this app.
+typedef enum
+{
+  /// Success code, no error
+  DR_ERROR_NO_ERROR = 0,
+  /// The wrong number of tests was given as an argument
+  DR_ERROR_WRONG_NUM_TESTS,
+  /// The wrong number of failure modes was given as an argument
+  DR_ERROR_WRONG_NUM_FAILURE_MODES,
+  /// A test result given is not valid
+  DR_ERROR_INVALID_TEST_RESULT,
+  /// Unable to open, close, or write to the specified file
+  DR_ERROR_FILE_ERROR,
+  /// Unable to save data to the specified file
+  DR_ERROR_SAVE_ERROR,
+  /// The d-matrix table is not in a format that can be used
+  DR_ERROR_INVALID_D_MATRIX,
+  /// The requested d-matrix engine can't be used here
+  DR_ERROR_UNSUPPORTED_ENGINE,
+  /// The d-matrix has more entries set than the sparse d-matrix can hold
+  DR_ERROR_TOO_MANY_NONZEROS,
+  /// The watchpoint to test mapping table doesn't fit the d-matrix or
+  /// the LC watchpoint results table
+  DR_ERROR_INVALID_WTM,
+} dr_error_type;
+
+#ifdef __cplusplus
+} // extern "C" {
+#endif
+
+#endif // DR_TYPES_H
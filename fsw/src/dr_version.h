@@ -1,19 +1,19 @@
-/////////////////////////////////////////////////////////////////////////
-// File:
-//   $Id: dr_version.h  $
-//
-// Purpose: 
-//  The DR header file containing version number
-//
-// Notes:
-/////////////////////////////////////////////////////////////////////////
-
-#ifndef DR_VERSION_H
-#define DR_VERSION_H
-
-#define DR_MAJOR_VERSION    1
-#define DR_MINOR_VERSION    0
-#define DR_REVISION         0
-#define DR_MISSION_REV      0
-      
-#endif // DR_VERSION_H
+/////////////////////////////////////////////////////////////////////////
+// File:
+//   $Id: dr_version.h  $
+//
+// Purpose: 
+//  The DR header file containing version number
+//
+// Notes:
+/////////////////////////////////////////////////////////////////////////
+
+#ifndef DR_VERSION_H
+#define DR_VERSION_H
+
+#define DR_MAJOR_VERSION    1
+#define DR_MINOR_VERSION    0
+#define DR_REVISION         0
+#define DR_MISSION_REV      0
+      
+#endif // DR_VERSION_H
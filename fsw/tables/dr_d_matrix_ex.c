@@ -1,32 +1,43 @@
-//
-// File defining an example D-matrix table. Follows the example
-// D-matrix in the DR user's manual.
-//
-
-#include "cfe_tbl_filedef.h"
-#include "dr_d_matrix_tbl.h"
-#include "dr_app.h"
-
-/*************************************************************************
-** Exported Data
-*************************************************************************/
-/*
-** Table file header
-*/
-static CFE_TBL_FileDef_t CFE_TBL_FileDef __attribute__((__used__)) =
-{
-  "dr_d_matrix_ex", DR_APP_NAME "." DR_D_MATRIX_NAME,
-    "DR d-matrix ex", "dr_d_matrix_ex.tbl",
-    (sizeof(dr_d_matrix_tbl_type))
-};
-
-dr_d_matrix_tbl_type dr_d_matrix_ex =
-{ 4,
-  5,
-  { { 1, 1, 1, 1 },
-    { 0, 1, 1, 0 },
-    { 0, 1, 1, 0 },
-    { 0, 0, 0, 1 },
-    { 0, 0, 1, 0 } }
-};
-
+//
+// File defining an example D-matrix table. Follows the example
+// D-matrix in the DR user's manual, with 4 tests and 5 failure modes,
+// in the packed table format. Each row is one byte, with bit j set if
+// test j implicates that failure mode.
+//
+
+#include "cfe_tbl_filedef.h"
+#include "dr_d_matrix_tbl.h"
+#include "dr_app.h"
+
+/*************************************************************************
+** Exported Data
+*************************************************************************/
+/*
+** Table file header. The whole table is loaded, since cFE won't load
+** part of a table that was never loaded; the rows past the example are
+** not used at this size.
+*/
+static CFE_TBL_FileDef_t CFE_TBL_FileDef __attribute__((__used__)) =
+{
+  "dr_d_matrix_ex", DR_APP_NAME "." DR_D_MATRIX_NAME,
+    "DR d-matrix ex", "dr_d_matrix_ex.tbl",
+    sizeof(dr_d_matrix_packed_tbl_type)
+};
+
+dr_d_matrix_packed_tbl_type dr_d_matrix_ex =
+{
+  .header =
+  {
+    .format = DR_D_MATRIX_PACKED_FORMAT,
+    .num_tests = 4,
+    .num_failure_modes = 5
+  },
+  //              tests: 3210
+  .d_matrix = { 0x0F, // 1111
+                0x06, // 0110
+                0x06, // 0110
+                0x08, // 1000
+                0x04  // 0100
+  }
+};
+
@@ -0,0 +1,124 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "dr_log_reader.h"
+
+// Converts a binary diagnosis log, saved by DR when
+// DR_RESULTS_LOG_FORMAT is DR_RESULTS_BINARY, to the test results and
+// failure modes CSV files DR saves otherwise, row for row. Delta records
+// are rebuilt into full rows. The header of each segment of the log is
+// printed as it is read.
+//
+// Usage: dr_log_convert log_file test_results_csv failure_modes_csv
+
+///////////////////////////////////////////////////////
+// Private function declarations
+//////////////////////////////////////////////////////
+
+// Writes a record's iteration, error and, if the error is
+// DR_ERROR_NO_ERROR, its values as a CSV row, as DR does.
+static void write_row(FILE * const csv, dr_log_record_type const * const record,
+                      uint32_t const num_values, int const values[]);
+
+int main(int argc, char * argv[])
+{
+  if (argc != 4)
+  {
+    fprintf(stderr, "Usage: %s log_file test_results_csv failure_modes_csv\n",
+            argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  static dr_log_reader_type reader;
+  bool const log_opened = dr_log_open(&reader, argv[1]);
+  FILE * const test_results_csv = fopen(argv[2], "w");
+  FILE * const failure_modes_csv = fopen(argv[3], "w");
+
+  if ( !log_opened || (NULL == test_results_csv) ||
+       (NULL == failure_modes_csv) )
+  {
+    fprintf(stderr, "%s: can't open the files\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  static int values[DR_MAX_MODEL_TESTS];
+  dr_log_header_type const * const header = &reader.header;
+  uint32_t num_keyframes = 0;
+  dr_log_read_result_type result;
+
+  while (DR_LOG_READ_RECORD == (result = dr_log_read(&reader)))
+  {
+    if (reader.new_segment)
+    {
+      printf("Segment at record %u: mode %d, %u tests, %u failure modes\n"
+             "  d-matrix %s, CRC 0x%08X\n"
+             "  wtm %s, CRC 0x%08X\n",
+             reader.num_records - 1, header->mode, header->num_tests,
+             header->num_failure_modes,
+             header->d_matrix_tbl_filename, header->d_matrix_crc,
+             header->wtm_tbl_filename, header->wtm_crc);
+    }
+
+    for (uint32_t i = 0; i < header->num_tests; ++i)
+    {
+      values[i] = reader.test_results[i];
+    }
+    write_row(test_results_csv, &reader.record, header->num_tests, values);
+
+    for (uint32_t i = 0; i < header->num_failure_modes; ++i)
+    {
+      values[i] = reader.failure_modes[i];
+    }
+    write_row(failure_modes_csv, &reader.record, header->num_failure_modes,
+              values);
+
+    if (reader.keyframe)
+    {
+      ++num_keyframes;
+    }
+  }
+
+  // A log DR stopped writing partway through a record ends with part of
+  // one, which is dropped.
+  if (DR_LOG_READ_PARTIAL == result)
+  {
+    fprintf(stderr, "%s: dropped the partial record at the end\n", argv[0]);
+  }
+  else if (DR_LOG_READ_BAD == result)
+  {
+    fprintf(stderr, "%s: not a DR log, or corrupt after record %u\n",
+            argv[0], reader.num_records);
+  }
+
+  printf("Converted %u records, %u of them keyframes\n", reader.num_records,
+         num_keyframes);
+
+  dr_log_close(&reader);
+  bool const closed = (0 == fclose(test_results_csv)) &&
+    (0 == fclose(failure_modes_csv));
+
+  return ( (DR_LOG_READ_BAD != result) && closed ) ?
+    EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+///////////////////////////////////////////////////////
+// Private function definitions
+//////////////////////////////////////////////////////
+
+static void write_row(FILE * const csv, dr_log_record_type const * const record,
+                      uint32_t const num_values, int const values[])
+{
+  fprintf(csv, "%d, %d, ", record->iteration, record->error);
+
+  if (DR_ERROR_NO_ERROR == record->error)
+  {
+    for (uint32_t i = 0; i < num_values; ++i)
+    {
+      fprintf(csv, "%d, ", values[i]);
+    }
+  }
+
+  fprintf(csv, "\n");
+}
@@ -0,0 +1,267 @@
+#include "dr_log_reader.h"
+
+#include <string.h>
+
+///////////////////////////////////////////////////////
+// Private function declarations
+//////////////////////////////////////////////////////
+
+// Reads the rest of a segment header, after its magic number. Returns
+// true if the header was read and is of a version and size this reader
+// knows.
+static bool read_header(dr_log_reader_type * const reader);
+
+// Reads the rest of a record of the given size, after its first word,
+// into the record bytes.
+static dr_log_read_result_type read_rest(dr_log_reader_type * const reader,
+                                         uint32_t const word,
+                                         uint32_t const size);
+
+// Reads the rest of a keyframe record, after its first word.
+static dr_log_read_result_type read_keyframe(dr_log_reader_type * const reader,
+                                             uint32_t const word);
+
+// Reads the rest of a delta record, after its first word, and applies
+// its changes to the values of the record before.
+static dr_log_read_result_type read_delta(dr_log_reader_type * const reader,
+                                          uint32_t const word);
+
+// Unpacks the values of the record read.
+static void unpack_values(dr_log_reader_type * const reader);
+
+///////////////////////////////////////////////////////
+// Public function definitions
+//////////////////////////////////////////////////////
+
+bool dr_log_open(dr_log_reader_type * const reader,
+                 char const * const filename)
+{
+  memset(reader, 0, sizeof(*reader));
+  reader->file = fopen(filename, "rb");
+
+  return (NULL != reader->file);
+}
+
+dr_log_read_result_type dr_log_read(dr_log_reader_type * const reader)
+{
+  dr_log_read_result_type result = DR_LOG_READ_BAD;
+  bool reading = true;
+
+  reader->new_segment = false;
+
+  // Read past the headers to the next record
+  while (reading)
+  {
+    uint32_t word = 0;
+    size_t const num_bytes = fread(&word, 1, sizeof(word), reader->file);
+    reading = false;
+
+    if (0 == num_bytes)
+    {
+      result = DR_LOG_READ_END;
+    }
+    else if (num_bytes < sizeof(word))
+    {
+      result = DR_LOG_READ_PARTIAL;
+    }
+    else if ( (DR_LOG_MAGIC == word) ||
+              (DR_LOG_MAGIC == dr_log_swap_uint32(word)) )
+    {
+      // A new segment, in the byte order its magic number is in. It
+      // starts with a keyframe.
+      reader->swapped = (DR_LOG_MAGIC != word);
+      reading = read_header(reader);
+      reader->have_header = reading;
+      reader->have_keyframe = false;
+      reader->new_segment = true;
+
+      if (!reading && feof(reader->file))
+      {
+        result = DR_LOG_READ_PARTIAL;
+      }
+    }
+    else if (reader->have_header)
+    {
+      uint32_t const tag = reader->swapped ? dr_log_swap_uint32(word) : word;
+
+      if (DR_LOG_RECORD_TAG == tag)
+      {
+        result = read_keyframe(reader, word);
+      }
+      else if ( (DR_LOG_DELTA_TAG == tag) && reader->have_keyframe )
+      {
+        result = read_delta(reader, word);
+      }
+    }
+  }
+
+  if (DR_LOG_READ_RECORD == result)
+  {
+    reader->num_records++;
+  }
+
+  return result;
+}
+
+void dr_log_close(dr_log_reader_type * const reader)
+{
+  if (NULL != reader->file)
+  {
+    fclose(reader->file);
+    reader->file = NULL;
+  }
+}
+
+///////////////////////////////////////////////////////
+// Private function definitions
+//////////////////////////////////////////////////////
+
+static bool read_header(dr_log_reader_type * const reader)
+{
+  dr_log_header_type * const header = &reader->header;
+  bool ok = (1 == fread(&header->version,
+                        sizeof(*header) - sizeof(header->magic), 1,
+                        reader->file));
+
+  if (ok && reader->swapped)
+  {
+    dr_log_swap_header(header);
+  }
+  header->magic = DR_LOG_MAGIC;
+
+  ok = ok &&
+    (header->version >= 1) && (header->version <= DR_LOG_VERSION) &&
+    (header->header_size == sizeof(*header)) &&
+    (header->num_tests <= DR_MAX_MODEL_TESTS) &&
+    (header->num_failure_modes <= DR_MAX_MODEL_FAILURE_MODES) &&
+    (header->record_size == dr_log_record_size(header->num_tests,
+                                               header->num_failure_modes));
+
+  // Make sure the filenames are terminated
+  header->d_matrix_tbl_filename[DR_LOG_FILENAME_LENGTH - 1] = '\0';
+  header->wtm_tbl_filename[DR_LOG_FILENAME_LENGTH - 1] = '\0';
+
+  return ok;
+}
+
+static dr_log_read_result_type read_rest(dr_log_reader_type * const reader,
+                                         uint32_t const word,
+                                         uint32_t const size)
+{
+  memcpy(reader->record_bytes, &word, sizeof(word));
+
+  size_t const num_bytes = fread(&reader->record_bytes[sizeof(word)], 1,
+                                 size - sizeof(word), reader->file);
+
+  return (num_bytes == (size - sizeof(word))) ?
+    DR_LOG_READ_RECORD : DR_LOG_READ_PARTIAL;
+}
+
+static dr_log_read_result_type read_keyframe(dr_log_reader_type * const reader,
+                                             uint32_t const word)
+{
+  dr_log_header_type const * const header = &reader->header;
+  dr_log_read_result_type const result =
+    read_rest(reader, word, header->record_size);
+
+  if (DR_LOG_READ_RECORD == result)
+  {
+    memcpy(&reader->record, reader->record_bytes, sizeof(reader->record));
+    if (reader->swapped)
+    {
+      dr_log_swap_record(&reader->record);
+    }
+
+    memcpy(reader->packed, &reader->record_bytes[sizeof(reader->record)],
+           DR_LOG_PACKED_BYTES(header->num_tests) +
+           DR_LOG_PACKED_BYTES(header->num_failure_modes));
+    unpack_values(reader);
+
+    reader->keyframe = true;
+    reader->have_keyframe = true;
+  }
+
+  return result;
+}
+
+static dr_log_read_result_type read_delta(dr_log_reader_type * const reader,
+                                          uint32_t const word)
+{
+  dr_log_header_type const * const header = &reader->header;
+  dr_log_delta_type delta;
+  uint32_t num_changes = 0;
+
+  // The fixed part gives the size of the rest. The writer saves a
+  // keyframe instead of a delta that wouldn't be smaller.
+  dr_log_read_result_type result = read_rest(reader, word, sizeof(delta));
+
+  if (DR_LOG_READ_RECORD == result)
+  {
+    memcpy(&delta, reader->record_bytes, sizeof(delta));
+    if (reader->swapped)
+    {
+      dr_log_swap_delta(&delta);
+    }
+
+    num_changes = delta.num_test_changes + delta.num_failure_mode_changes;
+    uint32_t const size = dr_log_delta_size(num_changes);
+
+    if (size >= header->record_size)
+    {
+      result = DR_LOG_READ_BAD;
+    }
+    else if (size > sizeof(delta))
+    {
+      size_t const num_bytes = fread(&reader->record_bytes[sizeof(delta)], 1,
+                                     size - sizeof(delta), reader->file);
+      if (num_bytes != (size - sizeof(delta)))
+      {
+        result = DR_LOG_READ_PARTIAL;
+      }
+    }
+  }
+
+  if (DR_LOG_READ_RECORD == result)
+  {
+    memcpy(reader->changes, &reader->record_bytes[sizeof(delta)],
+           num_changes * sizeof(reader->changes[0]));
+    if (reader->swapped)
+    {
+      for (uint32_t i = 0; i < num_changes; ++i)
+      {
+        reader->changes[i] = dr_log_swap_uint16(reader->changes[i]);
+      }
+    }
+
+    bool const applied =
+      dr_log_apply_changes(header->num_tests, delta.num_test_changes,
+                           reader->changes, reader->packed) &&
+      dr_log_apply_changes(header->num_failure_modes,
+                           delta.num_failure_mode_changes,
+                           &reader->changes[delta.num_test_changes],
+                           &reader->packed[DR_LOG_PACKED_BYTES(header->num_tests)]);
+
+    reader->record.tag = delta.tag;
+    reader->record.iteration = delta.iteration;
+    reader->record.seconds = delta.seconds;
+    reader->record.subseconds = delta.subseconds;
+    reader->record.error = delta.error;
+    unpack_values(reader);
+
+    reader->keyframe = false;
+    result = applied ? DR_LOG_READ_RECORD : DR_LOG_READ_BAD;
+  }
+
+  return result;
+}
+
+static void unpack_values(dr_log_reader_type * const reader)
+{
+  dr_log_header_type const * const header = &reader->header;
+
+  dr_log_unpack_test_results(header->num_tests, reader->packed,
+                             reader->test_results);
+  dr_log_unpack_failure_modes(header->num_failure_modes,
+                              &reader->packed[DR_LOG_PACKED_BYTES(header->num_tests)],
+                              reader->failure_modes);
+}
@@ -0,0 +1,88 @@
+#ifndef DR_LOG_READER_H
+#define DR_LOG_READER_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dr_log_format.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// What reading the next record of a binary diagnosis log found.
+typedef enum
+{
+  /// A record, whose values are now in the reader
+  DR_LOG_READ_RECORD = 0,
+  /// The end of the log
+  DR_LOG_READ_END,
+  /// Part of a record at the end of the log, as when DR stopped while
+  /// writing it. The part is dropped.
+  DR_LOG_READ_PARTIAL,
+  /// Something that isn't a header or record this reader knows, or a
+  /// delta record with no keyframe before it. Nothing more can be read.
+  DR_LOG_READ_BAD
+} dr_log_read_result_type;
+
+/// Reads a binary diagnosis log a record at a time, and rebuilds the full
+/// test results and failure modes of each, whether the record is a
+/// keyframe or a delta. After a record is read, everything here describes
+/// it.
+typedef struct
+{
+  /// The log file
+  FILE * file;
+  /// True if the segment being read is in the other byte order
+  bool swapped;
+  /// True once a header has been read
+  bool have_header;
+  /// True once the segment being read has had a keyframe, so deltas
+  /// can be applied
+  bool have_keyframe;
+  /// True if the record read started a new segment
+  bool new_segment;
+  /// True if the record read was a keyframe, false if a delta
+  bool keyframe;
+  /// The header of the segment being read, in this processor's byte
+  /// order
+  dr_log_header_type header;
+  /// The number of records read
+  uint32_t num_records;
+  /// The fixed part of the record read. For a delta, the tag is
+  /// DR_LOG_DELTA_TAG.
+  dr_log_record_type record;
+  /// The values of the record read, header.num_tests test results then
+  /// header.num_failure_modes failure modes
+  dr_test_result_type test_results[DR_MAX_MODEL_TESTS];
+  dr_failure_mode_type failure_modes[DR_MAX_MODEL_FAILURE_MODES];
+  /// The packed values of the record read, which the next delta
+  /// changes, and the bytes of the record being read
+  uint8_t packed[DR_LOG_MAX_RECORD_SIZE];
+  uint8_t record_bytes[DR_LOG_MAX_RECORD_SIZE];
+  /// The changes of the delta record read
+  uint16_t changes[DR_MAX_MODEL_TESTS + DR_MAX_MODEL_FAILURE_MODES];
+} dr_log_reader_type;
+
+/// Opens a binary diagnosis log for reading.
+/// @param [out] reader The reader. It is big, so best not on the stack.
+/// @param [in] filename The log file
+/// @return true if the file was opened; false otherwise
+bool dr_log_open(dr_log_reader_type * const reader,
+                 char const * const filename);
+
+/// Reads the next record, with the segment header before it, if any.
+/// @param [inout] reader The reader
+/// @return What was read
+dr_log_read_result_type dr_log_read(dr_log_reader_type * const reader);
+
+/// Closes the log.
+/// @param [inout] reader The reader
+void dr_log_close(dr_log_reader_type * const reader);
+
+#ifdef __cplusplus
+} // extern "C" {
+#endif
+
+#endif // DR_LOG_READER_H
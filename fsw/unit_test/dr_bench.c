@@ -0,0 +1,353 @@
+// clock_gettime() needs POSIX, which -std=c99 doesn't give by itself
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "dr_process_d_matrix.h"
+#include "dr_bitset_d_matrix.h"
+#include "dr_sparse_d_matrix.h"
+
+// Times the d-matrix solvers over a grid of synthetic d-matrix sizes,
+// densities and test failure rates, and prints the time of one solve
+// as JSON: one record per solver and grid point, with the p50, p99 and
+// maximum over many repetitions. Used to size models against the CPU
+// budget of a wakeup.
+//
+// Usage: dr_bench [repetitions]
+
+///////////////////////////////////////////////////////
+// Constants
+//////////////////////////////////////////////////////
+
+#define DEFAULT_REPETITIONS 1000
+
+// Solves done before timing starts, to warm up the caches and the
+// branch predictor
+#define WARMUP_REPETITIONS 50
+
+// The number of different test result vectors cycled through by the
+// repetitions, so the timing isn't of one lucky vector
+#define NUM_TEST_VECTORS 16
+
+typedef struct
+{
+  uint32_t num_tests;
+  uint32_t num_failure_modes;
+} bench_size_type;
+
+static bench_size_type const SIZES[] =
+  {
+    { 10, 10 },
+    { 50, 50 },
+    { 100, 100 },
+    { 500, 400 },
+    { 1000, 750 },
+    { DR_MAX_MODEL_TESTS, DR_MAX_MODEL_FAILURE_MODES }
+  };
+
+static uint32_t const DENSITY_PERCENTS[] = { 1, 5, 20 };
+
+static uint32_t const FAILURE_RATE_PERCENTS[] = { 1, 10, 50 };
+
+#define ARRAY_LENGTH(array) (sizeof(array) / sizeof((array)[0]))
+
+/// The solvers timed.
+typedef enum
+{
+  BENCH_REFERENCE = 0,
+  BENCH_BITSET,
+  BENCH_SPARSE,
+  BENCH_ENGINE_COUNT
+} bench_engine_type;
+
+static char const * const ENGINE_NAMES[BENCH_ENGINE_COUNT] =
+  { "reference", "bitset", "sparse" };
+
+///////////////////////////////////////////////////////
+// Private function declarations
+//////////////////////////////////////////////////////
+
+// Fills the fixed-size d-matrix, when the size fits it, and the packed
+// d-matrix with random entries, roughly density_percent of them set.
+static void randomize_d_matrix(bench_size_type const * const size,
+                               uint32_t const density_percent);
+
+// Fills the test result vectors, each test failing with roughly
+// failure_rate_percent chance, and otherwise passing, or unknown one
+// time in ten.
+static void randomize_test_results(uint32_t const num_tests,
+                                   uint32_t const failure_rate_percent);
+
+// Solves the d-matrix once with the given engine, for test result
+// vector v.
+static dr_error_type solve(bench_engine_type const engine,
+                           bench_size_type const * const size,
+                           uint32_t const v);
+
+// Times the given number of solves, one at a time, into samples in
+// nanoseconds, after the warmup solves.
+static bool time_solves(bench_engine_type const engine,
+                        bench_size_type const * const size,
+                        uint32_t const repetitions,
+                        double samples[]);
+
+// Compares two doubles, for qsort()
+static int compare_doubles(void const * a, void const * b);
+
+// Returns the time in nanoseconds from start to end.
+static double elapsed_nanoseconds(struct timespec const * const start,
+                                  struct timespec const * const end);
+
+// The d-matrices and solver storage are large enough that we keep them
+// off the stack.
+static dr_d_matrix_tbl_type d_matrix_tbl;
+static dr_d_matrix_packed_tbl_type packed_tbl;
+static dr_bitset_d_matrix_type bitset;
+static dr_sparse_d_matrix_type sparse;
+
+static dr_bitset_word_type
+  row_storage[DR_BITSET_ROW_STORAGE_WORDS(DR_MAX_MODEL_TESTS,
+                                          DR_MAX_MODEL_FAILURE_MODES)];
+static dr_bitset_word_type
+  col_storage[DR_BITSET_COL_STORAGE_WORDS(DR_MAX_MODEL_TESTS,
+                                          DR_MAX_MODEL_FAILURE_MODES)];
+
+static dr_sparse_offset_type sparse_row_starts[DR_MAX_MODEL_FAILURE_MODES + 1];
+static dr_sparse_index_type sparse_row_tests[DR_MAX_MODEL_NONZEROS];
+static dr_sparse_offset_type sparse_col_starts[DR_MAX_MODEL_TESTS + 1];
+static dr_sparse_index_type sparse_col_failure_modes[DR_MAX_MODEL_NONZEROS];
+
+static dr_test_result_type test_results[NUM_TEST_VECTORS][DR_MAX_MODEL_TESTS];
+static dr_failure_mode_type failure_modes[DR_MAX_MODEL_FAILURE_MODES];
+
+// The entries set in the current d-matrix
+static uint32_t num_nonzeros;
+
+int main(int argc, char * argv[])
+{
+  uint32_t repetitions = DEFAULT_REPETITIONS;
+  if (argc > 1)
+  {
+    repetitions = (uint32_t)strtoul(argv[1], NULL, 10);
+  }
+  if (0 == repetitions)
+  {
+    fprintf(stderr, "usage: dr_bench [repetitions]\n");
+    return EXIT_FAILURE;
+  }
+
+  double * const samples = malloc(sizeof(double) * repetitions);
+  if (NULL == samples)
+  {
+    fprintf(stderr, "dr_bench: out of memory\n");
+    return EXIT_FAILURE;
+  }
+
+  srand(1);
+  dr_init_bitset_d_matrix(&bitset, row_storage, col_storage,
+                          DR_MAX_MODEL_TESTS, DR_MAX_MODEL_FAILURE_MODES);
+  dr_init_sparse_d_matrix(&sparse, sparse_row_starts, sparse_row_tests,
+                          sparse_col_starts, sparse_col_failure_modes,
+                          DR_MAX_MODEL_TESTS, DR_MAX_MODEL_FAILURE_MODES,
+                          DR_MAX_MODEL_NONZEROS);
+
+  printf("{\n  \"repetitions\": %u,\n  \"results\": [", repetitions);
+  bool first_record = true;
+
+  for (uint32_t s = 0; s < ARRAY_LENGTH(SIZES); ++s)
+  {
+    for (uint32_t d = 0; d < ARRAY_LENGTH(DENSITY_PERCENTS); ++d)
+    {
+      randomize_d_matrix(&SIZES[s], DENSITY_PERCENTS[d]);
+
+      for (uint32_t f = 0; f < ARRAY_LENGTH(FAILURE_RATE_PERCENTS); ++f)
+      {
+        randomize_test_results(SIZES[s].num_tests, FAILURE_RATE_PERCENTS[f]);
+
+        for (int engine = 0; engine < BENCH_ENGINE_COUNT; ++engine)
+        {
+          // Engines that can't hold this d-matrix are left out
+          if (!time_solves((bench_engine_type)engine, &SIZES[s],
+                           repetitions, samples))
+          {
+            continue;
+          }
+
+          qsort(samples, repetitions, sizeof(double), compare_doubles);
+          double mean = 0.0;
+          for (uint32_t r = 0; r < repetitions; ++r)
+          {
+            mean += samples[r] / repetitions;
+          }
+
+          printf("%s\n    { \"engine\": \"%s\", \"num_tests\": %u, "
+                 "\"num_failure_modes\": %u, \"density_percent\": %u, "
+                 "\"failure_rate_percent\": %u, \"nonzeros\": %u, "
+                 "\"p50_ns\": %.0f, \"p99_ns\": %.0f, \"max_ns\": %.0f, "
+                 "\"mean_ns\": %.0f }",
+                 first_record ? "" : ",",
+                 ENGINE_NAMES[engine], SIZES[s].num_tests,
+                 SIZES[s].num_failure_modes, DENSITY_PERCENTS[d],
+                 FAILURE_RATE_PERCENTS[f], num_nonzeros,
+                 samples[(repetitions - 1) / 2],
+                 samples[((repetitions - 1) * 99) / 100],
+                 samples[repetitions - 1], mean);
+          first_record = false;
+        }
+      }
+    }
+  }
+
+  printf("\n  ]\n}\n");
+  free(samples);
+
+  return EXIT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////
+// Private function definitions
+//////////////////////////////////////////////////////
+
+void randomize_d_matrix(bench_size_type const * const size,
+                        uint32_t const density_percent)
+{
+  bool const fits_fixed = (size->num_tests <= DR_MAX_TESTS) &&
+    (size->num_failure_modes <= DR_MAX_FAILURE_MODES);
+  uint32_t const row_bytes = DR_D_MATRIX_PACKED_ROW_BYTES(size->num_tests);
+
+  packed_tbl.header.format = DR_D_MATRIX_PACKED_FORMAT;
+  packed_tbl.header.num_tests = size->num_tests;
+  packed_tbl.header.num_failure_modes = size->num_failure_modes;
+  memset(packed_tbl.d_matrix, 0, sizeof(packed_tbl.d_matrix));
+  num_nonzeros = 0;
+
+  if (fits_fixed)
+  {
+    d_matrix_tbl.num_tests = size->num_tests;
+    d_matrix_tbl.num_failure_modes = size->num_failure_modes;
+  }
+
+  for (uint32_t i = 0; i < size->num_failure_modes; ++i)
+  {
+    for (uint32_t j = 0; j < size->num_tests; ++j)
+    {
+      bool const entry = ((uint32_t)(rand() % 100) < density_percent);
+      if (entry)
+      {
+        ++num_nonzeros;
+        packed_tbl.d_matrix[(i * row_bytes) + (j / 8)] |= (uint8_t)(1u << (j % 8));
+      }
+      if (fits_fixed)
+      {
+        d_matrix_tbl.d_matrix[i][j] = entry;
+      }
+    }
+  }
+
+  // The compiled forms are built once per d-matrix, as the app does at
+  // table load, and aren't part of the timing.
+  dr_compile_packed_bitset_d_matrix(&packed_tbl, &bitset);
+  dr_compile_sparse_d_matrix(&bitset, &sparse);
+}
+
+void randomize_test_results(uint32_t const num_tests,
+                            uint32_t const failure_rate_percent)
+{
+  for (uint32_t v = 0; v < NUM_TEST_VECTORS; ++v)
+  {
+    for (uint32_t j = 0; j < num_tests; ++j)
+    {
+      if ((uint32_t)(rand() % 100) < failure_rate_percent)
+      {
+        test_results[v][j] = DR_TEST_RESULT_FAIL;
+      }
+      else
+      {
+        test_results[v][j] = ((rand() % 10) == 0) ?
+          DR_TEST_RESULT_UNKNOWN : DR_TEST_RESULT_PASS;
+      }
+    }
+  }
+}
+
+dr_error_type solve(bench_engine_type const engine,
+                    bench_size_type const * const size,
+                    uint32_t const v)
+{
+  dr_error_type error = DR_ERROR_UNSUPPORTED_ENGINE;
+
+  switch (engine)
+  {
+    case BENCH_REFERENCE:
+      error = dr_process_d_matrix(&d_matrix_tbl, size->num_tests,
+                                  test_results[v], size->num_failure_modes,
+                                  failure_modes);
+      break;
+    case BENCH_BITSET:
+      error = dr_process_bitset_d_matrix(&bitset, size->num_tests,
+                                         test_results[v],
+                                         size->num_failure_modes,
+                                         failure_modes);
+      break;
+    case BENCH_SPARSE:
+      error = dr_process_sparse_d_matrix(&sparse, size->num_tests,
+                                         test_results[v],
+                                         size->num_failure_modes,
+                                         failure_modes);
+      break;
+    case BENCH_ENGINE_COUNT:
+    default:
+      break;
+  }
+
+  return error;
+}
+
+bool time_solves(bench_engine_type const engine,
+                 bench_size_type const * const size,
+                 uint32_t const repetitions,
+                 double samples[])
+{
+  // A solver that can't take this d-matrix reports an argument error,
+  // such as the reference solver past DR_MAX_TESTS, or the sparse one
+  // past DR_MAX_MODEL_NONZEROS.
+  bool fits = (DR_ERROR_NO_ERROR == solve(engine, size, 0));
+
+  for (uint32_t r = 0; fits && (r < WARMUP_REPETITIONS); ++r)
+  {
+    solve(engine, size, r % NUM_TEST_VECTORS);
+  }
+
+  for (uint32_t r = 0; fits && (r < repetitions); ++r)
+  {
+    struct timespec start;
+    struct timespec end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    solve(engine, size, r % NUM_TEST_VECTORS);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    samples[r] = elapsed_nanoseconds(&start, &end);
+  }
+
+  return fits;
+}
+
+int compare_doubles(void const * a, void const * b)
+{
+  double const value_a = *(double const *)a;
+  double const value_b = *(double const *)b;
+  return (value_a > value_b) - (value_a < value_b);
+}
+
+double elapsed_nanoseconds(struct timespec const * const start,
+                           struct timespec const * const end)
+{
+  return ((double)(end->tv_sec - start->tv_sec) * 1e9) +
+    (double)(end->tv_nsec - start->tv_nsec);
+}
@@ -0,0 +1,162 @@
+// clock_gettime() needs POSIX, which -std=c99 doesn't give by itself
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "dr_kernels.h"
+
+// Times the first pass kernels of each instruction set this processor
+// supports, at a few failure mode counts, and prints the time of one
+// first pass and the speedup over the scalar kernel.
+
+///////////////////////////////////////////////////////
+// Constants
+//////////////////////////////////////////////////////
+
+// The tests of the synthetic d-matrix, and the percent of its entries set
+#define NUM_TESTS 100
+#define DENSITY_PERCENT 10
+
+// Roughly how many failure mode updates to time each kernel over
+#define UPDATES_PER_RUN 400000000ULL
+
+static char const * const ISA_NAMES[DR_KERNEL_COUNT] = { "scalar", "sse2", "avx2" };
+
+///////////////////////////////////////////////////////
+// Private function declarations
+//////////////////////////////////////////////////////
+
+// Returns the time in seconds from start to end.
+static double elapsed_seconds(struct timespec const * const start,
+                              struct timespec const * const end);
+
+// Runs the first pass over all the columns num_runs times with the
+// given kernel, and returns the seconds per run. The checksum of the
+// final state is added to checksum so the work can't be optimized out.
+static double time_kernel(dr_first_pass_kernel_type const kernel,
+                          uint32_t const num_failure_modes,
+                          uint8_t const columns[],
+                          dr_test_result_type const test_results[NUM_TESTS],
+                          uint32_t const num_runs,
+                          uint8_t state[],
+                          uint32_t * const checksum);
+
+int main(void)
+{
+  uint32_t const failure_mode_counts[] = { 100, 1000, 10000 };
+  uint32_t const num_counts = sizeof(failure_mode_counts) / sizeof(failure_mode_counts[0]);
+  uint32_t checksum = 0;
+
+  srand(1);
+
+  dr_test_result_type test_results[NUM_TESTS];
+  for (uint32_t j = 0; j < NUM_TESTS; ++j)
+  {
+    test_results[j] = rand() % DR_TEST_RESULT_COUNT;
+  }
+
+  printf("selected kernel: %s\n", ISA_NAMES[dr_select_kernel_isa()]);
+  printf("%16s %8s %14s %8s\n", "failure_modes", "kernel", "ns_per_pass", "speedup");
+
+  for (uint32_t c = 0; c < num_counts; ++c)
+  {
+    uint32_t const num_failure_modes = failure_mode_counts[c];
+    uint8_t * const columns = malloc((size_t)NUM_TESTS * num_failure_modes);
+    uint8_t * const state = malloc(num_failure_modes);
+
+    if ( (NULL == columns) || (NULL == state) )
+    {
+      printf("dr_kernel_bench: out of memory\n");
+      return EXIT_FAILURE;
+    }
+
+    for (uint32_t k = 0; k < (NUM_TESTS * num_failure_modes); ++k)
+    {
+      columns[k] = ((rand() % 100) < DENSITY_PERCENT);
+    }
+
+    uint32_t const num_runs = (uint32_t)
+      (UPDATES_PER_RUN / ((uint64_t)NUM_TESTS * num_failure_modes));
+    double scalar_seconds = 0.0;
+
+    for (int isa = 0; isa < DR_KERNEL_COUNT; ++isa)
+    {
+      dr_first_pass_kernel_type const kernel =
+        dr_get_first_pass_kernel((dr_kernel_isa_type)isa);
+
+      if (NULL != kernel)
+      {
+        // Warm up the caches and the branch predictor first
+        time_kernel(kernel, num_failure_modes, columns, test_results,
+                    1 + (num_runs / 10), state, &checksum);
+        double const seconds =
+          time_kernel(kernel, num_failure_modes, columns, test_results,
+                      num_runs, state, &checksum);
+
+        if (DR_KERNEL_SCALAR == isa)
+        {
+          scalar_seconds = seconds;
+        }
+
+        printf("%16u %8s %14.1f %7.2fx\n", num_failure_modes, ISA_NAMES[isa],
+               seconds * 1e9, scalar_seconds / seconds);
+      }
+    }
+
+    free(columns);
+    free(state);
+  }
+
+  printf("checksum: %u\n", checksum);
+
+  return EXIT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////
+// Private function definitions
+//////////////////////////////////////////////////////
+
+double elapsed_seconds(struct timespec const * const start,
+                       struct timespec const * const end)
+{
+  return (double)(end->tv_sec - start->tv_sec) +
+    ((double)(end->tv_nsec - start->tv_nsec) * 1e-9);
+}
+
+double time_kernel(dr_first_pass_kernel_type const kernel,
+                   uint32_t const num_failure_modes,
+                   uint8_t const columns[],
+                   dr_test_result_type const test_results[NUM_TESTS],
+                   uint32_t const num_runs,
+                   uint8_t state[],
+                   uint32_t * const checksum)
+{
+  struct timespec start;
+  struct timespec end;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  for (uint32_t run = 0; run < num_runs; ++run)
+  {
+    memset(state, DR_FAILURE_MODE_UNKNOWN, num_failure_modes);
+    for (uint32_t j = 0; j < NUM_TESTS; ++j)
+    {
+      kernel(num_failure_modes, &(columns[j * num_failure_modes]),
+             test_results[j], state);
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  for (uint32_t i = 0; i < num_failure_modes; ++i)
+  {
+    *checksum += state[i];
+  }
+
+  return elapsed_seconds(&start, &end) / num_runs;
+}
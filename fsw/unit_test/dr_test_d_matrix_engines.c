@@ -0,0 +1,1176 @@
+#include "dr_test_d_matrix_engines.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dr_process_d_matrix.h"
+#include "dr_bitset_d_matrix.h"
+#include "dr_incremental_d_matrix.h"
+#include "dr_sparse_d_matrix.h"
+#include "dr_component_d_matrix.h"
+#include "dr_sliced_d_matrix.h"
+#include "dr_kernels.h"
+#include "dr_stats.h"
+#include "dr_test_d_matrix_examples.h"
+
+///////////////////////////////////////////////////////
+// Constants
+//////////////////////////////////////////////////////
+
+#define NUM_RANDOM_TRIALS 10000
+#define NUM_INCREMENTAL_TRIALS 500
+#define NUM_INCREMENTAL_STEPS 50
+#define NUM_PACKED_TRIALS 1000
+#define NUM_LARGE_MODEL_STEPS 200
+#define NUM_COMPONENT_TRIALS 500
+#define NUM_COMPONENT_STEPS 50
+#define NUM_BATCH_TRIALS 500
+#define MAX_BATCH_VECTORS 150
+#define NUM_SLICED_TRIALS 500
+#define NUM_SINGLE_FAULT_TRIALS 200
+#define NUM_DOUBLE_FAULT_TRIALS 20
+#define NUM_KERNEL_TRIALS 2000
+#define MAX_KERNEL_FAILURE_MODES 300
+
+///////////////////////////////////////////////////////
+// Private function declarations
+//////////////////////////////////////////////////////
+
+// Fills the d-matrix with a random size and random entries, with
+// roughly density_percent of the entries set, and fills the test
+// results with random pass, fail, and unknown values.
+static void randomize_d_matrix(dr_d_matrix_tbl_type * const d_matrix_tbl,
+                               int const density_percent,
+                               dr_test_result_type test_results[DR_MAX_TESTS]);
+
+// Fills the d-matrix with a random size, split into num_blocks random
+// independent blocks of tests and failure modes, with roughly
+// density_percent of the entries inside each block set.
+static void randomize_block_d_matrix(dr_d_matrix_tbl_type * const d_matrix_tbl,
+                                     int const num_blocks,
+                                     int const density_percent,
+                                     dr_test_result_type test_results[DR_MAX_TESTS]);
+
+// Injects every set of max_faults failure modes or fewer into the
+// d-matrix, max_faults being 1 or 2, solving DR_SLICED_LANES of these
+// scenarios at a time with the bit-sliced solver. Checks each against
+// the reference d-matrix solver given the test results the faults
+// cause, and that no faulted failure mode is found good.
+static bool run_fault_campaign(dr_d_matrix_tbl_type const * const d_matrix_tbl,
+                               uint32_t const max_faults);
+
+// Gives the sparse d-matrix its storage, sized for the largest model.
+static void init_sparse(void);
+
+// Checks that every entry of the sparse d-matrix joins a test and a
+// failure mode of the same component, and that the component lists
+// hold each test and failure mode exactly once.
+static bool are_components_valid(dr_sparse_d_matrix_type const * const sparse,
+                                 dr_components_type const * const components);
+
+// Packs a fixed-size d-matrix table into the packed table format.
+static void pack_d_matrix(dr_d_matrix_tbl_type const * const d_matrix_tbl,
+                          dr_d_matrix_packed_tbl_type * const packed_tbl);
+
+// Gives the compiled bitsets their storage, sized for the largest model.
+static void init_bitset(void);
+
+static bool are_failure_modes_equal(uint32_t const num_failure_modes,
+        dr_failure_mode_type const failure_modes_1[num_failure_modes],
+        dr_failure_mode_type const failure_modes_2[num_failure_modes]);
+
+// The d-matrix tables and compiled bitsets are large enough that
+// we keep them off the stack.
+static dr_d_matrix_tbl_type d_matrix_tbl;
+static dr_d_matrix_packed_tbl_type packed_tbl;
+static dr_bitset_d_matrix_type bitset;
+static dr_bitset_d_matrix_type packed_bitset;
+static dr_incremental_state_type incremental_state;
+static dr_sparse_d_matrix_type sparse;
+static dr_components_type components;
+static dr_component_state_type component_state;
+static dr_test_result_type batch_test_results[MAX_BATCH_VECTORS][DR_MAX_TESTS];
+static dr_failure_mode_type batch_failure_modes[MAX_BATCH_VECTORS][DR_MAX_FAILURE_MODES];
+static dr_sliced_planes_type sliced_planes;
+
+static dr_bitset_word_type
+  row_storage[DR_BITSET_ROW_STORAGE_WORDS(DR_MAX_MODEL_TESTS,
+                                          DR_MAX_MODEL_FAILURE_MODES)];
+static dr_bitset_word_type
+  col_storage[DR_BITSET_COL_STORAGE_WORDS(DR_MAX_MODEL_TESTS,
+                                          DR_MAX_MODEL_FAILURE_MODES)];
+static dr_bitset_word_type
+  packed_row_storage[DR_BITSET_ROW_STORAGE_WORDS(DR_MAX_MODEL_TESTS,
+                                                 DR_MAX_MODEL_FAILURE_MODES)];
+static dr_bitset_word_type
+  packed_col_storage[DR_BITSET_COL_STORAGE_WORDS(DR_MAX_MODEL_TESTS,
+                                                 DR_MAX_MODEL_FAILURE_MODES)];
+
+static dr_sparse_offset_type sparse_row_starts[DR_MAX_MODEL_FAILURE_MODES + 1];
+static dr_sparse_index_type sparse_row_tests[DR_MAX_MODEL_NONZEROS];
+static dr_sparse_offset_type sparse_col_starts[DR_MAX_MODEL_TESTS + 1];
+static dr_sparse_index_type sparse_col_failure_modes[DR_MAX_MODEL_NONZEROS];
+
+///////////////////////////////////////////////////////
+// Public function definitions
+//////////////////////////////////////////////////////
+
+bool test_d_matrix_bitset_engine(void)
+{
+  bool test_passed = true;
+  init_bitset();
+
+  for(int trial = 0; (trial < NUM_RANDOM_TRIALS) && test_passed; ++trial)
+  {
+    // Sweep the density so that both sparse and dense d-matrices,
+    // which exercise different paths of the bad check, are covered.
+    dr_test_result_type test_results[DR_MAX_TESTS];
+    randomize_d_matrix(&d_matrix_tbl, 1 + (trial % 60), test_results);
+
+    dr_failure_mode_type expected[DR_MAX_FAILURE_MODES];
+    dr_error_type error =
+      dr_process_d_matrix(&d_matrix_tbl, d_matrix_tbl.num_tests, test_results,
+                          d_matrix_tbl.num_failure_modes, expected);
+    if(DR_ERROR_NO_ERROR != error)
+    {
+      return false;
+    }
+
+    dr_compile_bitset_d_matrix(&d_matrix_tbl, &bitset);
+
+    dr_failure_mode_type actual[DR_MAX_FAILURE_MODES];
+    error = dr_process_bitset_d_matrix(&bitset, d_matrix_tbl.num_tests,
+                                       test_results,
+                                       d_matrix_tbl.num_failure_modes, actual);
+    if(DR_ERROR_NO_ERROR != error)
+    {
+      return false;
+    }
+
+    test_passed = are_failure_modes_equal(d_matrix_tbl.num_failure_modes,
+                                          expected, actual);
+  }
+
+  return test_passed;
+}
+
+bool test_d_matrix_bitset_engine_args(void)
+{
+  init_bitset();
+  initialize_example_d_matrix(&d_matrix_tbl);
+  dr_compile_bitset_d_matrix(&d_matrix_tbl, &bitset);
+
+  // One extra entry so the wrong number of tests can be passed in
+  dr_test_result_type const invalid_results[DR_TEST_EXAMPLE_NUM_TESTS + 1] =
+    {
+      DR_TEST_RESULT_PASS,
+      255,
+      DR_TEST_RESULT_FAIL,
+      131,
+      DR_TEST_RESULT_PASS
+    };
+  dr_failure_mode_type failure_modes[DR_MAX_FAILURE_MODES];
+
+  bool test_passed =
+    (DR_ERROR_WRONG_NUM_TESTS ==
+     dr_process_bitset_d_matrix(&bitset, DR_TEST_EXAMPLE_NUM_TESTS + 1,
+                                invalid_results,
+                                DR_TEST_EXAMPLE_NUM_FAILURE_MODES,
+                                failure_modes));
+
+  test_passed = test_passed &&
+    (DR_ERROR_WRONG_NUM_FAILURE_MODES ==
+     dr_process_bitset_d_matrix(&bitset, DR_TEST_EXAMPLE_NUM_TESTS,
+                                invalid_results,
+                                DR_TEST_EXAMPLE_NUM_FAILURE_MODES + 1,
+                                failure_modes));
+
+  test_passed = test_passed &&
+    (DR_ERROR_INVALID_TEST_RESULT ==
+     dr_process_bitset_d_matrix(&bitset, DR_TEST_EXAMPLE_NUM_TESTS,
+                                invalid_results,
+                                DR_TEST_EXAMPLE_NUM_FAILURE_MODES,
+                                failure_modes));
+
+  return test_passed;
+}
+
+bool test_d_matrix_bitset_engine_batch(void)
+{
+  bool test_passed = true;
+  init_bitset();
+
+  for(int trial = 0; (trial < NUM_BATCH_TRIALS) && test_passed; ++trial)
+  {
+    dr_test_result_type test_results[DR_MAX_TESTS];
+    randomize_d_matrix(&d_matrix_tbl, 1 + (trial % 60), test_results);
+    dr_compile_bitset_d_matrix(&d_matrix_tbl, &bitset);
+
+    uint32_t const num_tests = d_matrix_tbl.num_tests;
+    uint32_t const num_failure_modes = d_matrix_tbl.num_failure_modes;
+
+    // Vary the number of vectors so both full and partial blocks of
+    // vectors, and an empty batch, are covered. The vectors are packed
+    // at the model's size, one after another.
+    uint32_t const num_vectors = trial % (MAX_BATCH_VECTORS + 1);
+    dr_test_result_type (* const vector_results)[num_tests] =
+      (dr_test_result_type (*)[num_tests])batch_test_results;
+    dr_failure_mode_type (* const vector_failure_modes)[num_failure_modes] =
+      (dr_failure_mode_type (*)[num_failure_modes])batch_failure_modes;
+
+    for(uint32_t v = 0; v < num_vectors; ++v)
+    {
+      for(uint32_t j = 0; j < num_tests; ++j)
+      {
+        vector_results[v][j] = rand() % DR_TEST_RESULT_COUNT;
+      }
+    }
+
+    dr_error_type error =
+      dr_process_bitset_d_matrix_batch(&bitset, num_vectors,
+                                       num_tests, vector_results,
+                                       num_failure_modes, vector_failure_modes);
+    if(DR_ERROR_NO_ERROR != error)
+    {
+      return false;
+    }
+
+    for(uint32_t v = 0; (v < num_vectors) && test_passed; ++v)
+    {
+      dr_failure_mode_type expected[DR_MAX_FAILURE_MODES];
+      error = dr_process_d_matrix(&d_matrix_tbl, num_tests, vector_results[v],
+                                  num_failure_modes, expected);
+      test_passed = (DR_ERROR_NO_ERROR == error) &&
+        are_failure_modes_equal(num_failure_modes, expected,
+                                vector_failure_modes[v]);
+    }
+
+    // An invalid test result in the last vector is reported, and none
+    // of the vectors are solved.
+    if( test_passed && (num_vectors > 0) )
+    {
+      for(uint32_t i = 0; i < num_failure_modes; ++i)
+      {
+        vector_failure_modes[0][i] = DR_FAILURE_MODE_COUNT;
+      }
+      vector_results[num_vectors - 1][num_tests - 1] = DR_TEST_RESULT_COUNT;
+
+      error = dr_process_bitset_d_matrix_batch(&bitset, num_vectors,
+                                               num_tests, vector_results,
+                                               num_failure_modes,
+                                               vector_failure_modes);
+      test_passed = (DR_ERROR_INVALID_TEST_RESULT == error) &&
+        (DR_FAILURE_MODE_COUNT == vector_failure_modes[0][0]);
+    }
+
+    test_passed = test_passed &&
+      (DR_ERROR_WRONG_NUM_TESTS ==
+       dr_process_bitset_d_matrix_batch(&bitset, num_vectors,
+                                        num_tests + 1, vector_results,
+                                        num_failure_modes,
+                                        vector_failure_modes)) &&
+      (DR_ERROR_WRONG_NUM_FAILURE_MODES ==
+       dr_process_bitset_d_matrix_batch(&bitset, num_vectors,
+                                        num_tests, vector_results,
+                                        num_failure_modes + 1,
+                                        vector_failure_modes));
+  }
+
+  return test_passed;
+}
+
+bool test_d_matrix_sliced_engine(void)
+{
+  bool test_passed = true;
+  init_bitset();
+
+  for(int trial = 0; (trial < NUM_SLICED_TRIALS) && test_passed; ++trial)
+  {
+    dr_test_result_type test_results[DR_MAX_TESTS];
+    randomize_d_matrix(&d_matrix_tbl, 1 + (trial % 60), test_results);
+    dr_compile_bitset_d_matrix(&d_matrix_tbl, &bitset);
+
+    uint32_t const num_tests = d_matrix_tbl.num_tests;
+    uint32_t const num_failure_modes = d_matrix_tbl.num_failure_modes;
+
+    // Vary the number of vectors to cover full and partial sets of
+    // lanes, packed at the model's size as for the batch test.
+    uint32_t const num_vectors = trial % (MAX_BATCH_VECTORS + 1);
+    dr_test_result_type (* const vector_results)[num_tests] =
+      (dr_test_result_type (*)[num_tests])batch_test_results;
+    dr_failure_mode_type (* const vector_failure_modes)[num_failure_modes] =
+      (dr_failure_mode_type (*)[num_failure_modes])batch_failure_modes;
+
+    for(uint32_t v = 0; v < num_vectors; ++v)
+    {
+      for(uint32_t j = 0; j < num_tests; ++j)
+      {
+        vector_results[v][j] = rand() % DR_TEST_RESULT_COUNT;
+      }
+    }
+
+    dr_error_type error =
+      dr_process_sliced_d_matrix_batch(&bitset, &sliced_planes, num_vectors,
+                                       num_tests, vector_results,
+                                       num_failure_modes, vector_failure_modes);
+    if(DR_ERROR_NO_ERROR != error)
+    {
+      return false;
+    }
+
+    for(uint32_t v = 0; (v < num_vectors) && test_passed; ++v)
+    {
+      dr_failure_mode_type expected[DR_MAX_FAILURE_MODES];
+      error = dr_process_d_matrix(&d_matrix_tbl, num_tests, vector_results[v],
+                                  num_failure_modes, expected);
+      test_passed = (DR_ERROR_NO_ERROR == error) &&
+        are_failure_modes_equal(num_failure_modes, expected,
+                                vector_failure_modes[v]);
+    }
+
+    test_passed = test_passed &&
+      (DR_ERROR_WRONG_NUM_TESTS ==
+       dr_process_sliced_d_matrix_batch(&bitset, &sliced_planes, num_vectors,
+                                        num_tests + 1, vector_results,
+                                        num_failure_modes,
+                                        vector_failure_modes));
+  }
+
+  return test_passed;
+}
+
+bool test_d_matrix_single_fault_campaign(void)
+{
+  init_bitset();
+  initialize_example_d_matrix(&d_matrix_tbl);
+  bool test_passed = run_fault_campaign(&d_matrix_tbl, 1);
+
+  for(int trial = 0; (trial < NUM_SINGLE_FAULT_TRIALS) && test_passed; ++trial)
+  {
+    dr_test_result_type test_results[DR_MAX_TESTS];
+    randomize_d_matrix(&d_matrix_tbl, 1 + (trial % 30), test_results);
+    test_passed = run_fault_campaign(&d_matrix_tbl, 1);
+  }
+
+  return test_passed;
+}
+
+bool test_d_matrix_double_fault_campaign(void)
+{
+  init_bitset();
+  initialize_example_d_matrix(&d_matrix_tbl);
+  bool test_passed = run_fault_campaign(&d_matrix_tbl, 2);
+
+  for(int trial = 0; (trial < NUM_DOUBLE_FAULT_TRIALS) && test_passed; ++trial)
+  {
+    dr_test_result_type test_results[DR_MAX_TESTS];
+    randomize_d_matrix(&d_matrix_tbl, 1 + (trial % 30), test_results);
+    test_passed = run_fault_campaign(&d_matrix_tbl, 2);
+  }
+
+  return test_passed;
+}
+
+bool test_d_matrix_kernels(void)
+{
+  bool test_passed = dr_kernel_is_supported(DR_KERNEL_SCALAR) &&
+    dr_kernel_is_supported(dr_select_kernel_isa());
+
+  // Every supported kernel must match the scalar one, for lengths that
+  // leave every possible tail after the vector part.
+  for(int trial = 0; (trial < NUM_KERNEL_TRIALS) && test_passed; ++trial)
+  {
+    uint32_t const num_failure_modes = rand() % MAX_KERNEL_FAILURE_MODES;
+    dr_test_result_type const test_result = rand() % DR_TEST_RESULT_COUNT;
+    uint8_t implicated[MAX_KERNEL_FAILURE_MODES];
+    uint8_t expected[MAX_KERNEL_FAILURE_MODES];
+
+    for(uint32_t i = 0; i < num_failure_modes; ++i)
+    {
+      implicated[i] = ((rand() % 3) == 0) ? (uint8_t)(1 + (rand() % 255)) : 0;
+      expected[i] = rand() % DR_FAILURE_MODE_COUNT;
+    }
+
+    uint8_t state[DR_KERNEL_COUNT][MAX_KERNEL_FAILURE_MODES];
+    for(int isa = 0; isa < DR_KERNEL_COUNT; ++isa)
+    {
+      memcpy(state[isa], expected, num_failure_modes);
+    }
+
+    dr_get_first_pass_kernel(DR_KERNEL_SCALAR)(num_failure_modes, implicated,
+                                               test_result, expected);
+
+    for(int isa = 0; (isa < DR_KERNEL_COUNT) && test_passed; ++isa)
+    {
+      dr_first_pass_kernel_type const kernel =
+        dr_get_first_pass_kernel((dr_kernel_isa_type)isa);
+      if(NULL != kernel)
+      {
+        kernel(num_failure_modes, implicated, test_result, state[isa]);
+        test_passed = (0 == memcmp(expected, state[isa], num_failure_modes));
+      }
+    }
+  }
+
+  // The whole first pass must find the same good failure modes as the
+  // reference solver, and suspect ones where it finds suspect or bad.
+  for(int trial = 0; (trial < NUM_KERNEL_TRIALS) && test_passed; ++trial)
+  {
+    dr_test_result_type test_results[DR_MAX_TESTS];
+    randomize_d_matrix(&d_matrix_tbl, 1 + (trial % 60), test_results);
+
+    uint32_t const num_tests = d_matrix_tbl.num_tests;
+    uint32_t const num_failure_modes = d_matrix_tbl.num_failure_modes;
+
+    static uint8_t columns[DR_MAX_TESTS][DR_MAX_FAILURE_MODES];
+    for(uint32_t j = 0; j < num_tests; ++j)
+    {
+      for(uint32_t i = 0; i < num_failure_modes; ++i)
+      {
+        columns[j][i] = d_matrix_tbl.d_matrix[i][j];
+      }
+    }
+
+    uint8_t state[DR_MAX_FAILURE_MODES];
+    dr_kernel_first_pass(num_tests, test_results, num_failure_modes,
+                         &(columns[0][0]), DR_MAX_FAILURE_MODES, state);
+
+    dr_failure_mode_type expected[DR_MAX_FAILURE_MODES];
+    test_passed = (DR_ERROR_NO_ERROR ==
+                   dr_process_d_matrix(&d_matrix_tbl, num_tests, test_results,
+                                       num_failure_modes, expected));
+
+    for(uint32_t i = 0; (i < num_failure_modes) && test_passed; ++i)
+    {
+      dr_failure_mode_type const first_pass =
+        (DR_FAILURE_MODE_BAD == expected[i]) ? DR_FAILURE_MODE_SUSPECT : expected[i];
+      test_passed = (first_pass == state[i]);
+    }
+  }
+
+  return test_passed;
+}
+
+bool test_stats(void)
+{
+  // The bins are the powers of two, with everything from 2^20 up in
+  // the last one.
+  bool test_passed = (0 == dr_stats_histogram_bin(0)) &&
+    (0 == dr_stats_histogram_bin(1)) &&
+    (1 == dr_stats_histogram_bin(2)) &&
+    (1 == dr_stats_histogram_bin(3)) &&
+    (10 == dr_stats_histogram_bin(1024)) &&
+    (10 == dr_stats_histogram_bin(2047)) &&
+    ((DR_STATS_HISTOGRAM_BINS - 1) == dr_stats_histogram_bin(1u << 20)) &&
+    ((DR_STATS_HISTOGRAM_BINS - 1) == dr_stats_histogram_bin(UINT32_MAX));
+
+  dr_stats_type stats;
+  dr_reset_stats(&stats);
+  test_passed = test_passed && (0 == stats.count) && (0 == stats.min_usec);
+
+  uint32_t const times[] = { 300, 5, 4000000, 300, 1 };
+  uint32_t const num_times = sizeof(times) / sizeof(times[0]);
+  for(uint32_t t = 0; t < num_times; ++t)
+  {
+    dr_record_stats(&stats, times[t]);
+  }
+
+  test_passed = test_passed &&
+    (num_times == stats.count) &&
+    (1 == stats.last_usec) &&
+    (1 == stats.min_usec) &&
+    (4000000 == stats.max_usec) &&
+    (((300 + 5 + 4000000 + 300 + 1) / num_times) == stats.mean_usec) &&
+    (2 == stats.histogram[dr_stats_histogram_bin(300)]) &&
+    (1 == stats.histogram[2]) &&
+    (1 == stats.histogram[0]) &&
+    (1 == stats.histogram[DR_STATS_HISTOGRAM_BINS - 1]);
+
+  dr_reset_stats(&stats);
+  dr_record_stats(&stats, 7);
+  test_passed = test_passed && (1 == stats.count) && (7 == stats.min_usec) &&
+    (7 == stats.max_usec) && (7 == stats.mean_usec) &&
+    (1 == stats.histogram[2]);
+
+  return test_passed;
+}
+
+bool test_d_matrix_implication_count_engine(void)
+{
+  bool test_passed = true;
+
+  for(int trial = 0; (trial < NUM_RANDOM_TRIALS) && test_passed; ++trial)
+  {
+    // Go all the way up to fully dense d-matrices here, since those
+    // are the worst case for the original bad check.
+    dr_test_result_type test_results[DR_MAX_TESTS];
+    randomize_d_matrix(&d_matrix_tbl, 1 + (trial % 100), test_results);
+
+    dr_failure_mode_type expected[DR_MAX_FAILURE_MODES];
+    dr_error_type error =
+      dr_process_d_matrix(&d_matrix_tbl, d_matrix_tbl.num_tests, test_results,
+                          d_matrix_tbl.num_failure_modes, expected);
+    if(DR_ERROR_NO_ERROR != error)
+    {
+      return false;
+    }
+
+    dr_failure_mode_type actual[DR_MAX_FAILURE_MODES];
+    error = dr_process_d_matrix_counted(&d_matrix_tbl, d_matrix_tbl.num_tests,
+                                        test_results,
+                                        d_matrix_tbl.num_failure_modes, actual);
+    if(DR_ERROR_NO_ERROR != error)
+    {
+      return false;
+    }
+
+    test_passed = are_failure_modes_equal(d_matrix_tbl.num_failure_modes,
+                                          expected, actual);
+  }
+
+  return test_passed;
+}
+
+bool test_d_matrix_incremental_engine(void)
+{
+  bool test_passed = true;
+  init_bitset();
+
+  for(int trial = 0; (trial < NUM_INCREMENTAL_TRIALS) && test_passed; ++trial)
+  {
+    dr_test_result_type test_results[DR_MAX_TESTS];
+    randomize_d_matrix(&d_matrix_tbl, 1 + (trial % 60), test_results);
+    dr_compile_bitset_d_matrix(&d_matrix_tbl, &bitset);
+    dr_reset_incremental_d_matrix(&incremental_state);
+
+    for(int step = 0; (step < NUM_INCREMENTAL_STEPS) && test_passed; ++step)
+    {
+      // Change a few test results each step; most steps change zero
+      // or one, which is the common case in flight.
+      int const num_changes = rand() % 4;
+      for(int c = 0; c < num_changes; ++c)
+      {
+        test_results[rand() % d_matrix_tbl.num_tests] =
+          rand() % DR_TEST_RESULT_COUNT;
+      }
+
+      dr_failure_mode_type expected[DR_MAX_FAILURE_MODES];
+      dr_error_type error =
+        dr_process_d_matrix(&d_matrix_tbl, d_matrix_tbl.num_tests,
+                            test_results, d_matrix_tbl.num_failure_modes,
+                            expected);
+      if(DR_ERROR_NO_ERROR != error)
+      {
+        return false;
+      }
+
+      dr_failure_mode_type actual[DR_MAX_FAILURE_MODES];
+      error = dr_process_incremental_d_matrix(&bitset, &incremental_state,
+                                              d_matrix_tbl.num_tests,
+                                              test_results,
+                                              d_matrix_tbl.num_failure_modes,
+                                              actual);
+      if(DR_ERROR_NO_ERROR != error)
+      {
+        return false;
+      }
+
+      test_passed = are_failure_modes_equal(d_matrix_tbl.num_failure_modes,
+                                            expected, actual);
+    }
+  }
+
+  // An invalid test result must be rejected without disturbing the
+  // state, so the following diagnosis is still correct.
+  if(test_passed)
+  {
+    dr_test_result_type test_results[DR_MAX_TESTS];
+    for(uint32_t j = 0; j < d_matrix_tbl.num_tests; ++j)
+    {
+      test_results[j] = incremental_state.test_results[j];
+    }
+    test_results[0] = DR_TEST_RESULT_COUNT;
+
+    dr_failure_mode_type actual[DR_MAX_FAILURE_MODES];
+    test_passed = (DR_ERROR_INVALID_TEST_RESULT ==
+                   dr_process_incremental_d_matrix(&bitset, &incremental_state,
+                                                   d_matrix_tbl.num_tests,
+                                                   test_results,
+                                                   d_matrix_tbl.num_failure_modes,
+                                                   actual));
+
+    test_results[0] = DR_TEST_RESULT_FAIL;
+    dr_failure_mode_type expected[DR_MAX_FAILURE_MODES];
+    dr_process_d_matrix(&d_matrix_tbl, d_matrix_tbl.num_tests, test_results,
+                        d_matrix_tbl.num_failure_modes, expected);
+    dr_process_incremental_d_matrix(&bitset, &incremental_state,
+                                    d_matrix_tbl.num_tests, test_results,
+                                    d_matrix_tbl.num_failure_modes, actual);
+
+    test_passed = test_passed &&
+      are_failure_modes_equal(d_matrix_tbl.num_failure_modes,
+                              expected, actual);
+  }
+
+  return test_passed;
+}
+
+bool test_d_matrix_sparse_engine(void)
+{
+  bool test_passed = true;
+  init_bitset();
+  init_sparse();
+
+  for(int trial = 0; (trial < NUM_RANDOM_TRIALS) && test_passed; ++trial)
+  {
+    // Mostly sparse d-matrices, which this engine is for, but all the
+    // way up to fully dense ones to be sure.
+    dr_test_result_type test_results[DR_MAX_TESTS];
+    randomize_d_matrix(&d_matrix_tbl, 1 + (trial % 100), test_results);
+
+    dr_failure_mode_type expected[DR_MAX_FAILURE_MODES];
+    dr_error_type error =
+      dr_process_d_matrix(&d_matrix_tbl, d_matrix_tbl.num_tests, test_results,
+                          d_matrix_tbl.num_failure_modes, expected);
+    if(DR_ERROR_NO_ERROR != error)
+    {
+      return false;
+    }
+
+    dr_compile_bitset_d_matrix(&d_matrix_tbl, &bitset);
+    error = dr_compile_sparse_d_matrix(&bitset, &sparse);
+    if(DR_ERROR_NO_ERROR != error)
+    {
+      return false;
+    }
+
+    dr_failure_mode_type actual[DR_MAX_FAILURE_MODES];
+    error = dr_process_sparse_d_matrix(&sparse, d_matrix_tbl.num_tests,
+                                       test_results,
+                                       d_matrix_tbl.num_failure_modes, actual);
+    if(DR_ERROR_NO_ERROR != error)
+    {
+      return false;
+    }
+
+    test_passed = are_failure_modes_equal(d_matrix_tbl.num_failure_modes,
+                                          expected, actual);
+  }
+
+  return test_passed;
+}
+
+bool test_d_matrix_sparse_engine_args(void)
+{
+  init_bitset();
+  init_sparse();
+  initialize_example_d_matrix(&d_matrix_tbl);
+  dr_compile_bitset_d_matrix(&d_matrix_tbl, &bitset);
+
+  bool test_passed =
+    (DR_ERROR_NO_ERROR == dr_compile_sparse_d_matrix(&bitset, &sparse));
+
+  // One extra entry so the wrong number of tests can be passed in
+  dr_test_result_type const invalid_results[DR_TEST_EXAMPLE_NUM_TESTS + 1] =
+    {
+      DR_TEST_RESULT_PASS,
+      255,
+      DR_TEST_RESULT_FAIL,
+      131,
+      DR_TEST_RESULT_PASS
+    };
+  dr_failure_mode_type failure_modes[DR_MAX_FAILURE_MODES];
+
+  test_passed = test_passed &&
+    (DR_ERROR_WRONG_NUM_TESTS ==
+     dr_process_sparse_d_matrix(&sparse, DR_TEST_EXAMPLE_NUM_TESTS + 1,
+                                invalid_results,
+                                DR_TEST_EXAMPLE_NUM_FAILURE_MODES,
+                                failure_modes));
+
+  test_passed = test_passed &&
+    (DR_ERROR_WRONG_NUM_FAILURE_MODES ==
+     dr_process_sparse_d_matrix(&sparse, DR_TEST_EXAMPLE_NUM_TESTS,
+                                invalid_results,
+                                DR_TEST_EXAMPLE_NUM_FAILURE_MODES + 1,
+                                failure_modes));
+
+  test_passed = test_passed &&
+    (DR_ERROR_INVALID_TEST_RESULT ==
+     dr_process_sparse_d_matrix(&sparse, DR_TEST_EXAMPLE_NUM_TESTS,
+                                invalid_results,
+                                DR_TEST_EXAMPLE_NUM_FAILURE_MODES,
+                                failure_modes));
+
+  // Storage for fewer entries than the example has must be refused,
+  // leaving an empty d-matrix.
+  dr_init_sparse_d_matrix(&sparse, sparse_row_starts, sparse_row_tests,
+                          sparse_col_starts, sparse_col_failure_modes,
+                          DR_MAX_MODEL_TESTS, DR_MAX_MODEL_FAILURE_MODES, 3);
+  test_passed = test_passed &&
+    (DR_ERROR_TOO_MANY_NONZEROS == dr_compile_sparse_d_matrix(&bitset, &sparse)) &&
+    (0 == sparse.num_tests) && (0 == sparse.num_failure_modes);
+
+  return test_passed;
+}
+
+bool test_d_matrix_component_engine(void)
+{
+  bool test_passed = true;
+  init_bitset();
+  init_sparse();
+
+  for(int trial = 0; (trial < NUM_COMPONENT_TRIALS) && test_passed; ++trial)
+  {
+    dr_test_result_type test_results[DR_MAX_TESTS];
+    randomize_block_d_matrix(&d_matrix_tbl, 1 + (trial % 12),
+                             1 + (trial % 60), test_results);
+    dr_compile_bitset_d_matrix(&d_matrix_tbl, &bitset);
+    dr_compile_sparse_d_matrix(&bitset, &sparse);
+    dr_partition_d_matrix(&sparse, &components);
+    dr_reset_component_d_matrix(&component_state);
+
+    test_passed = are_components_valid(&sparse, &components);
+
+    for(int step = 0; (step < NUM_COMPONENT_STEPS) && test_passed; ++step)
+    {
+      // Change a test or two each step, so most components are left
+      // alone.
+      int const num_changes = rand() % 3;
+      for(int c = 0; c < num_changes; ++c)
+      {
+        test_results[rand() % d_matrix_tbl.num_tests] =
+          rand() % DR_TEST_RESULT_COUNT;
+      }
+
+      dr_failure_mode_type expected[DR_MAX_FAILURE_MODES];
+      dr_error_type error =
+        dr_process_d_matrix(&d_matrix_tbl, d_matrix_tbl.num_tests,
+                            test_results, d_matrix_tbl.num_failure_modes,
+                            expected);
+      if(DR_ERROR_NO_ERROR != error)
+      {
+        return false;
+      }
+
+      dr_failure_mode_type actual[DR_MAX_FAILURE_MODES];
+      error = dr_process_component_d_matrix(&sparse, &components,
+                                            &component_state,
+                                            d_matrix_tbl.num_tests,
+                                            test_results,
+                                            d_matrix_tbl.num_failure_modes,
+                                            actual);
+      if(DR_ERROR_NO_ERROR != error)
+      {
+        return false;
+      }
+
+      // Past the first step, no more components are solved than
+      // there were tests changed.
+      test_passed = are_failure_modes_equal(d_matrix_tbl.num_failure_modes,
+                                            expected, actual) &&
+        ( (0 == step) ||
+          (component_state.num_solved_components <= (uint32_t)num_changes) );
+    }
+  }
+
+  return test_passed;
+}
+
+bool test_d_matrix_packed_table(void)
+{
+  bool test_passed = true;
+  init_bitset();
+
+  for(int trial = 0; (trial < NUM_PACKED_TRIALS) && test_passed; ++trial)
+  {
+    dr_test_result_type test_results[DR_MAX_TESTS];
+    randomize_d_matrix(&d_matrix_tbl, 1 + (trial % 60), test_results);
+    pack_d_matrix(&d_matrix_tbl, &packed_tbl);
+
+    test_passed =
+      (DR_ERROR_NO_ERROR == dr_compile_bitset_d_matrix(&d_matrix_tbl, &bitset)) &&
+      (DR_ERROR_NO_ERROR == dr_compile_packed_bitset_d_matrix(&packed_tbl,
+                                                              &packed_bitset));
+
+    // Both tables must compile to exactly the same bitsets
+    for(uint32_t i = 0; (i < d_matrix_tbl.num_failure_modes) && test_passed; ++i)
+    {
+      for(uint32_t j = 0; (j < d_matrix_tbl.num_tests) && test_passed; ++j)
+      {
+        test_passed =
+          (d_matrix_tbl.d_matrix[i][j] ==
+           dr_d_matrix_packed_entry(&packed_tbl, i, j)) &&
+          (d_matrix_tbl.d_matrix[i][j] ==
+           DR_BITSET_TEST(dr_bitset_row(&packed_bitset, i), j)) &&
+          (d_matrix_tbl.d_matrix[i][j] ==
+           DR_BITSET_TEST(dr_bitset_col(&packed_bitset, j), i));
+      }
+    }
+
+    if(test_passed)
+    {
+      dr_failure_mode_type expected[DR_MAX_FAILURE_MODES];
+      dr_failure_mode_type actual[DR_MAX_FAILURE_MODES];
+      dr_process_d_matrix(&d_matrix_tbl, d_matrix_tbl.num_tests, test_results,
+                          d_matrix_tbl.num_failure_modes, expected);
+      test_passed =
+        (DR_ERROR_NO_ERROR ==
+         dr_process_bitset_d_matrix(&packed_bitset, d_matrix_tbl.num_tests,
+                                    test_results,
+                                    d_matrix_tbl.num_failure_modes, actual)) &&
+        are_failure_modes_equal(d_matrix_tbl.num_failure_modes,
+                                expected, actual);
+    }
+  }
+
+  // A bad header, or a model bigger than the storage, is rejected and
+  // leaves an empty d-matrix.
+  packed_tbl.header.format = 0;
+  test_passed = test_passed &&
+    (DR_ERROR_INVALID_D_MATRIX ==
+     dr_compile_packed_bitset_d_matrix(&packed_tbl, &packed_bitset)) &&
+    (0 == packed_bitset.num_tests) && (0 == packed_bitset.num_failure_modes);
+
+  packed_tbl.header.format = DR_D_MATRIX_PACKED_FORMAT;
+  packed_tbl.header.num_tests = DR_MAX_MODEL_TESTS + 1;
+  test_passed = test_passed &&
+    (DR_ERROR_INVALID_D_MATRIX ==
+     dr_compile_packed_bitset_d_matrix(&packed_tbl, &packed_bitset));
+
+  dr_init_bitset_d_matrix(&packed_bitset, packed_row_storage,
+                          packed_col_storage, DR_MAX_TESTS,
+                          DR_MAX_FAILURE_MODES);
+  packed_tbl.header.num_tests = DR_MAX_TESTS + 1;
+  packed_tbl.header.num_failure_modes = 1;
+  test_passed = test_passed &&
+    (DR_ERROR_WRONG_NUM_TESTS ==
+     dr_compile_packed_bitset_d_matrix(&packed_tbl, &packed_bitset));
+
+  packed_tbl.header.num_tests = 1;
+  packed_tbl.header.num_failure_modes = DR_MAX_FAILURE_MODES + 1;
+  test_passed = test_passed &&
+    (DR_ERROR_WRONG_NUM_FAILURE_MODES ==
+     dr_compile_packed_bitset_d_matrix(&packed_tbl, &packed_bitset));
+
+  return test_passed;
+}
+
+bool test_d_matrix_large_model(void)
+{
+  bool test_passed = true;
+  init_bitset();
+
+  // A model of the largest size, sparse as real models are, with each
+  // failure mode implicated by a handful of tests.
+  static dr_test_result_type test_results[DR_MAX_MODEL_TESTS];
+  static dr_failure_mode_type expected[DR_MAX_MODEL_FAILURE_MODES];
+  static dr_failure_mode_type actual[DR_MAX_MODEL_FAILURE_MODES];
+
+  uint32_t const num_tests = DR_MAX_MODEL_TESTS;
+  uint32_t const num_failure_modes = DR_MAX_MODEL_FAILURE_MODES;
+  uint32_t const row_bytes = DR_D_MATRIX_PACKED_ROW_BYTES(num_tests);
+
+  memset(&packed_tbl, 0, sizeof(packed_tbl));
+  packed_tbl.header.format = DR_D_MATRIX_PACKED_FORMAT;
+  packed_tbl.header.num_tests = num_tests;
+  packed_tbl.header.num_failure_modes = num_failure_modes;
+
+  for(uint32_t i = 0; i < num_failure_modes; ++i)
+  {
+    for(int k = 0; k < 8; ++k)
+    {
+      uint32_t const j = rand() % num_tests;
+      packed_tbl.d_matrix[(i * row_bytes) + (j / 8)] |= (uint8_t)(1u << (j % 8));
+    }
+  }
+
+  for(uint32_t j = 0; j < num_tests; ++j)
+  {
+    test_results[j] = rand() % DR_TEST_RESULT_COUNT;
+  }
+
+  test_passed =
+    (DR_ERROR_NO_ERROR == dr_compile_packed_bitset_d_matrix(&packed_tbl,
+                                                            &packed_bitset)) &&
+    (num_tests == packed_bitset.num_tests) &&
+    (num_failure_modes == packed_bitset.num_failure_modes);
+  dr_reset_incremental_d_matrix(&incremental_state);
+
+  init_sparse();
+  test_passed = test_passed &&
+    (DR_ERROR_NO_ERROR == dr_compile_sparse_d_matrix(&packed_bitset, &sparse));
+  dr_partition_d_matrix(&sparse, &components);
+  dr_reset_component_d_matrix(&component_state);
+  test_passed = test_passed && are_components_valid(&sparse, &components);
+
+  for(int step = 0; (step < NUM_LARGE_MODEL_STEPS) && test_passed; ++step)
+  {
+    int const num_changes = rand() % 8;
+    for(int c = 0; c < num_changes; ++c)
+    {
+      test_results[rand() % num_tests] = rand() % DR_TEST_RESULT_COUNT;
+    }
+
+    test_passed =
+      (DR_ERROR_NO_ERROR ==
+       dr_process_bitset_d_matrix(&packed_bitset, num_tests, test_results,
+                                  num_failure_modes, expected)) &&
+      (DR_ERROR_NO_ERROR ==
+       dr_process_incremental_d_matrix(&packed_bitset, &incremental_state,
+                                       num_tests, test_results,
+                                       num_failure_modes, actual)) &&
+      are_failure_modes_equal(num_failure_modes, expected, actual) &&
+      (DR_ERROR_NO_ERROR ==
+       dr_process_sparse_d_matrix(&sparse, num_tests, test_results,
+                                  num_failure_modes, actual)) &&
+      are_failure_modes_equal(num_failure_modes, expected, actual) &&
+      (DR_ERROR_NO_ERROR ==
+       dr_process_component_d_matrix(&sparse, &components, &component_state,
+                                     num_tests, test_results,
+                                     num_failure_modes, actual)) &&
+      are_failure_modes_equal(num_failure_modes, expected, actual);
+  }
+
+  return test_passed;
+}
+
+///////////////////////////////////////////////////////
+// Private function definitions
+//////////////////////////////////////////////////////
+
+void randomize_d_matrix(dr_d_matrix_tbl_type * const d_matrix_tbl,
+                        int const density_percent,
+                        dr_test_result_type test_results[DR_MAX_TESTS])
+{
+  d_matrix_tbl->num_tests = 1 + (rand() % DR_MAX_TESTS);
+  d_matrix_tbl->num_failure_modes = 1 + (rand() % DR_MAX_FAILURE_MODES);
+
+  for(uint32_t i = 0; i < d_matrix_tbl->num_failure_modes; ++i)
+  {
+    for(uint32_t j = 0; j < d_matrix_tbl->num_tests; ++j)
+    {
+      d_matrix_tbl->d_matrix[i][j] = ((rand() % 100) < density_percent);
+    }
+  }
+
+  for(uint32_t j = 0; j < d_matrix_tbl->num_tests; ++j)
+  {
+    test_results[j] = rand() % DR_TEST_RESULT_COUNT;
+  }
+}
+
+void randomize_block_d_matrix(dr_d_matrix_tbl_type * const d_matrix_tbl,
+                              int const num_blocks,
+                              int const density_percent,
+                              dr_test_result_type test_results[DR_MAX_TESTS])
+{
+  int test_block[DR_MAX_TESTS];
+
+  d_matrix_tbl->num_tests = 1 + (rand() % DR_MAX_TESTS);
+  d_matrix_tbl->num_failure_modes = 1 + (rand() % DR_MAX_FAILURE_MODES);
+
+  for(uint32_t j = 0; j < d_matrix_tbl->num_tests; ++j)
+  {
+    test_block[j] = rand() % num_blocks;
+    test_results[j] = rand() % DR_TEST_RESULT_COUNT;
+  }
+
+  for(uint32_t i = 0; i < d_matrix_tbl->num_failure_modes; ++i)
+  {
+    int const block = rand() % num_blocks;
+    for(uint32_t j = 0; j < d_matrix_tbl->num_tests; ++j)
+    {
+      d_matrix_tbl->d_matrix[i][j] = (block == test_block[j]) &&
+        ((rand() % 100) < density_percent);
+    }
+  }
+}
+
+bool run_fault_campaign(dr_d_matrix_tbl_type const * const d_matrix_tbl,
+                        uint32_t const max_faults)
+{
+  bool test_passed = true;
+  dr_compile_bitset_d_matrix(d_matrix_tbl, &bitset);
+
+  uint32_t const num_tests = d_matrix_tbl->num_tests;
+  uint32_t const num_failure_modes = d_matrix_tbl->num_failure_modes;
+  dr_failure_mode_type (* const lane_failure_modes)[num_failure_modes] =
+    (dr_failure_mode_type (*)[num_failure_modes])batch_failure_modes;
+
+  // The faulted failure modes of each lane. A single fault is written
+  // as a pair of the same failure mode.
+  uint32_t lane_faults[DR_SLICED_LANES][2];
+  dr_bitset_word_type faults[DR_MAX_FAILURE_MODES];
+  uint32_t num_lanes = 0;
+
+  // Walk the scenarios in order, (0,0), (0,1), ... (1,1), (1,2), ...
+  // with second == first for the single faults, and solve them a full
+  // set of lanes at a time, plus the last partial set.
+  uint32_t first = 0;
+  uint32_t second = 0;
+  bool done = (0 == num_failure_modes);
+
+  while(!done && test_passed)
+  {
+    if(0 == num_lanes)
+    {
+      memset(faults, 0, sizeof(faults));
+    }
+
+    lane_faults[num_lanes][0] = first;
+    lane_faults[num_lanes][1] = second;
+    faults[first] |= (dr_bitset_word_type)1 << num_lanes;
+    faults[second] |= (dr_bitset_word_type)1 << num_lanes;
+    ++num_lanes;
+
+    if( (max_faults > 1) && ((second + 1) < num_failure_modes) )
+    {
+      ++second;
+    }
+    else
+    {
+      ++first;
+      second = first;
+      done = (first >= num_failure_modes);
+    }
+
+    if( (DR_SLICED_LANES == num_lanes) || done )
+    {
+      dr_slice_faults(&bitset, num_lanes, faults, &sliced_planes);
+      dr_process_sliced_d_matrix(&bitset, &sliced_planes);
+      dr_unslice_failure_modes(&sliced_planes, num_failure_modes,
+                               lane_failure_modes);
+
+      for(uint32_t v = 0; (v < num_lanes) && test_passed; ++v)
+      {
+        uint32_t const fault_1 = lane_faults[v][0];
+        uint32_t const fault_2 = lane_faults[v][1];
+
+        dr_test_result_type test_results[DR_MAX_TESTS];
+        for(uint32_t j = 0; j < num_tests; ++j)
+        {
+          test_results[j] = (d_matrix_tbl->d_matrix[fault_1][j] ||
+                             d_matrix_tbl->d_matrix[fault_2][j]) ?
+            DR_TEST_RESULT_FAIL : DR_TEST_RESULT_PASS;
+        }
+
+        dr_failure_mode_type expected[DR_MAX_FAILURE_MODES];
+        dr_error_type const error =
+          dr_process_d_matrix(d_matrix_tbl, num_tests, test_results,
+                              num_failure_modes, expected);
+
+        test_passed = (DR_ERROR_NO_ERROR == error) &&
+          are_failure_modes_equal(num_failure_modes, expected,
+                                  lane_failure_modes[v]) &&
+          (DR_FAILURE_MODE_GOOD != lane_failure_modes[v][fault_1]) &&
+          (DR_FAILURE_MODE_GOOD != lane_failure_modes[v][fault_2]);
+      }
+
+      num_lanes = 0;
+    }
+  }
+
+  return test_passed;
+}
+
+void init_sparse(void)
+{
+  dr_init_sparse_d_matrix(&sparse, sparse_row_starts, sparse_row_tests,
+                          sparse_col_starts, sparse_col_failure_modes,
+                          DR_MAX_MODEL_TESTS, DR_MAX_MODEL_FAILURE_MODES,
+                          DR_MAX_MODEL_NONZEROS);
+}
+
+bool are_components_valid(dr_sparse_d_matrix_type const * const sparse,
+                          dr_components_type const * const components)
+{
+  bool valid = (components->num_tests == sparse->num_tests) &&
+    (components->num_failure_modes == sparse->num_failure_modes) &&
+    (components->test_starts[components->num_components] == sparse->num_tests) &&
+    (components->failure_mode_starts[components->num_components] ==
+     sparse->num_failure_modes);
+
+  for(uint32_t i = 0; (i < sparse->num_failure_modes) && valid; ++i)
+  {
+    for(uint32_t k = sparse->row_starts[i];
+        (k < sparse->row_starts[i + 1]) && valid; ++k)
+    {
+      valid = (components->failure_mode_component[i] ==
+               components->test_component[sparse->row_tests[k]]);
+    }
+  }
+
+  for(uint32_t c = 0; (c < components->num_components) && valid; ++c)
+  {
+    // Every component has a member, and lists only its own members
+    valid = (components->test_starts[c] < components->test_starts[c + 1]) ||
+      (components->failure_mode_starts[c] < components->failure_mode_starts[c + 1]);
+
+    for(uint32_t k = components->test_starts[c];
+        (k < components->test_starts[c + 1]) && valid; ++k)
+    {
+      valid = (c == components->test_component[components->tests[k]]);
+    }
+    for(uint32_t k = components->failure_mode_starts[c];
+        (k < components->failure_mode_starts[c + 1]) && valid; ++k)
+    {
+      valid = (c == components->failure_mode_component[components->failure_modes[k]]);
+    }
+  }
+
+  return valid;
+}
+
+void pack_d_matrix(dr_d_matrix_tbl_type const * const d_matrix_tbl,
+                   dr_d_matrix_packed_tbl_type * const packed_tbl)
+{
+  uint32_t const row_bytes = DR_D_MATRIX_PACKED_ROW_BYTES(d_matrix_tbl->num_tests);
+
+  memset(packed_tbl, 0, sizeof(*packed_tbl));
+  packed_tbl->header.format = DR_D_MATRIX_PACKED_FORMAT;
+  packed_tbl->header.num_tests = d_matrix_tbl->num_tests;
+  packed_tbl->header.num_failure_modes = d_matrix_tbl->num_failure_modes;
+
+  for(uint32_t i = 0; i < d_matrix_tbl->num_failure_modes; ++i)
+  {
+    for(uint32_t j = 0; j < d_matrix_tbl->num_tests; ++j)
+    {
+      if(d_matrix_tbl->d_matrix[i][j])
+      {
+        packed_tbl->d_matrix[(i * row_bytes) + (j / 8)] |=
+          (uint8_t)(1u << (j % 8));
+      }
+    }
+  }
+}
+
+void init_bitset(void)
+{
+  dr_init_bitset_d_matrix(&bitset, row_storage, col_storage,
+                          DR_MAX_MODEL_TESTS, DR_MAX_MODEL_FAILURE_MODES);
+  dr_init_bitset_d_matrix(&packed_bitset, packed_row_storage,
+                          packed_col_storage, DR_MAX_MODEL_TESTS,
+                          DR_MAX_MODEL_FAILURE_MODES);
+}
+
+bool are_failure_modes_equal(uint32_t const num_failure_modes,
+        dr_failure_mode_type const failure_modes_1[num_failure_modes],
+        dr_failure_mode_type const failure_modes_2[num_failure_modes])
+{
+  bool failure_modes_are_equal = true;
+
+  for(uint32_t i = 0; i < num_failure_modes; ++i)
+  {
+    if(failure_modes_1[i] != failure_modes_2[i])
+    {
+      printf("  failure mode %u differs: %d != %d\n", i,
+             failure_modes_1[i], failure_modes_2[i]);
+      failure_modes_are_equal = false;
+      break;
+    }
+  }
+
+  return failure_modes_are_equal;
+}
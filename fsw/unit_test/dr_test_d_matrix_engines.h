@@ -0,0 +1,125 @@
+#ifndef DR_TEST_D_MATRIX_ENGINES_H
+#define DR_TEST_D_MATRIX_ENGINES_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//////////////////////////////////////////////
+// Public functions
+///////////////////////////////////////////////
+
+// For many randomly-generated d-matrices and test
+// results, compiles the d-matrix into bitsets and checks
+// that the bitset solver gives the same failure modes as
+// the reference d-matrix solver.
+// Returns true if the test passed; false otherwise.
+bool test_d_matrix_bitset_engine(void);
+
+// Checks that the bitset solver reports the same argument
+// errors as the reference d-matrix solver.
+// Returns true if the test passed; false otherwise.
+bool test_d_matrix_bitset_engine_args(void);
+
+// For many randomly-generated d-matrices, solves a batch of
+// random test result vectors in one call and checks that each
+// gives the same failure modes as the reference d-matrix
+// solver. Also checks that an invalid vector or size is
+// reported without solving any vector.
+// Returns true if the test passed; false otherwise.
+bool test_d_matrix_bitset_engine_batch(void);
+
+// For many randomly-generated d-matrices, solves a batch of
+// random test result vectors with the bit-sliced solver, 64
+// scenarios at a time, and checks that each gives the same
+// failure modes as the reference d-matrix solver.
+// Returns true if the test passed; false otherwise.
+bool test_d_matrix_sliced_engine(void);
+
+// For the example d-matrix and many randomly-generated ones,
+// injects each failure mode in turn with the bit-sliced solver,
+// and checks every scenario against the reference d-matrix solver
+// given the test results the fault causes. The faulted failure
+// mode must never be found good.
+// Returns true if the test passed; false otherwise.
+bool test_d_matrix_single_fault_campaign(void);
+
+// Same as test_d_matrix_single_fault_campaign(), for every pair of
+// failure modes faulted together.
+// Returns true if the test passed; false otherwise.
+bool test_d_matrix_double_fault_campaign(void);
+
+// Checks that every first pass kernel this processor supports
+// gives the same failure mode states as the scalar kernel, and
+// that the first pass over d-matrix columns agrees with the
+// reference d-matrix solver.
+// Returns true if the test passed; false otherwise.
+bool test_d_matrix_kernels(void);
+
+// Checks the timing statistics kept for the performance
+// telemetry: the minimum, maximum, mean and last times, and
+// the log-scale histogram bins, including times past the last
+// bin, and that a reset clears them.
+// Returns true if the test passed; false otherwise.
+bool test_stats(void);
+
+// For many randomly-generated d-matrices and test
+// results, including fully dense ones, checks that the
+// implication count solver gives the same failure modes as
+// the reference d-matrix solver.
+// Returns true if the test passed; false otherwise.
+bool test_d_matrix_implication_count_engine(void);
+
+// For many randomly-generated d-matrices, runs a sequence
+// of diagnoses where a few test results change each time, and
+// checks that the incremental solver gives the same failure
+// modes as a full solve with the reference d-matrix solver
+// at every step.
+// Returns true if the test passed; false otherwise.
+bool test_d_matrix_incremental_engine(void);
+
+// For many randomly-generated d-matrices and test
+// results, compresses the d-matrix into its sparse rows
+// and columns and checks that the sparse solver gives the same
+// failure modes as the reference d-matrix solver.
+// Returns true if the test passed; false otherwise.
+bool test_d_matrix_sparse_engine(void);
+
+// Checks that the sparse solver reports the same argument
+// errors as the reference d-matrix solver, and that a d-matrix
+// with more entries than the storage holds is refused.
+// Returns true if the test passed; false otherwise.
+bool test_d_matrix_sparse_engine_args(void);
+
+// For many randomly-generated d-matrices made of independent
+// blocks, checks that the connected components found are
+// consistent with the d-matrix, then runs a sequence of
+// diagnoses where a few test results change each time, and
+// checks that the component solver gives the same failure modes
+// as the reference d-matrix solver while only solving the
+// components with changed tests.
+// Returns true if the test passed; false otherwise.
+bool test_d_matrix_component_engine(void);
+
+// For many randomly-generated d-matrices, packs the d-matrix
+// into the variable-size table format and checks that it
+// compiles to the same bitsets and failure modes as the
+// fixed-size table. Also checks that bad headers and models too
+// big for the storage are rejected.
+// Returns true if the test passed; false otherwise.
+bool test_d_matrix_packed_table(void);
+
+// Builds a sparse d-matrix of the largest model size, and checks
+// that the incremental, sparse and component solvers agree with the bitset solver over
+// a sequence of changing test results.
+// Returns true if the test passed; false otherwise.
+bool test_d_matrix_large_model(void);
+
+#ifdef __cplusplus
+}  // extern "C" {
+#endif
+  
+
+#endif // DR_TEST_D_MATRIX_ENGINES_H
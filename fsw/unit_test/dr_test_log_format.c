@@ -0,0 +1,678 @@
+#include "dr_test_log_format.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "osapi.h" // for dr_test_fail_os_writes()
+#include "dr_platform_cfg.h" // for DR_RESULTS_KEYFRAME_INTERVAL
+#include "dr_log_format.h"
+#include "dr_save_results.h"
+#include "dr_log_reader.h"
+
+///////////////////////////////////////////////////////
+// Constants
+//////////////////////////////////////////////////////
+
+#define NUM_LOG_TRIALS 200
+
+#define LOG_FILENAME "dr_test_results.log"
+
+// The model of the first segment of the round trip log, and of the
+// second
+#define LOG_TESTS 300
+#define LOG_FAILURE_MODES 200
+#define LOG_SECOND_TESTS 37
+#define LOG_SECOND_FAILURE_MODES 5
+
+// The records of the segments, the record of the first whose values
+// all change, and the record of the first whose write fails
+#define NUM_FIRST_SEGMENT_RECORDS ((2 * DR_RESULTS_KEYFRAME_INTERVAL) + 50)
+#define NUM_SECOND_SEGMENT_RECORDS 20
+#define ALL_CHANGED_RECORD 10
+#define FAILED_WRITE_RECORD (DR_RESULTS_KEYFRAME_INTERVAL + 30)
+#define MAX_LOG_RECORDS \
+  (NUM_FIRST_SEGMENT_RECORDS + NUM_SECOND_SEGMENT_RECORDS)
+
+// The model of the logs built by hand for the reader test, big enough
+// that a delta of two changes is smaller than a keyframe
+#define SMALL_LOG_TESTS 40
+#define SMALL_LOG_FAILURE_MODES 20
+
+///////////////////////////////////////////////////////
+// Private types
+//////////////////////////////////////////////////////
+
+// A record saved to the round trip log, as it should be read back
+typedef struct
+{
+  int iteration;
+  dr_error_type error;
+  bool keyframe;
+  bool new_segment;
+  uint32_t segment;
+  dr_test_result_type test_results[LOG_TESTS];
+  dr_failure_mode_type failure_modes[LOG_FAILURE_MODES];
+} log_record_type;
+
+// The round trip log being saved: the headers of its segments, the
+// records that should be read back, and the values saved last, and
+// whether the next record saved starts a segment and should be a
+// keyframe.
+typedef struct
+{
+  dr_log_header_type headers[2];
+  uint32_t num_segments;
+  log_record_type records[MAX_LOG_RECORDS];
+  uint32_t num_records;
+  uint32_t num_tests;
+  uint32_t num_failure_modes;
+  dr_test_result_type test_results[LOG_TESTS];
+  dr_failure_mode_type failure_modes[LOG_FAILURE_MODES];
+  bool new_segment;
+  bool keyframe_needed;
+  uint32_t records_since_keyframe;
+} log_state_type;
+
+// A log of one segment of a small model, a keyframe then a delta,
+// built by hand, and the values of each record.
+typedef struct
+{
+  uint8_t bytes[512];
+  uint32_t header_size;
+  uint32_t keyframe_size;
+  uint32_t delta_size;
+  dr_test_result_type keyframe_tests[SMALL_LOG_TESTS];
+  dr_failure_mode_type keyframe_failure_modes[SMALL_LOG_FAILURE_MODES];
+  dr_test_result_type delta_tests[SMALL_LOG_TESTS];
+  dr_failure_mode_type delta_failure_modes[SMALL_LOG_FAILURE_MODES];
+} small_log_type;
+
+///////////////////////////////////////////////////////
+// Private function declarations
+//////////////////////////////////////////////////////
+
+// Saves the header of a new segment of the round trip log, of a model
+// with random values. Returns true if it was saved.
+static bool start_log_segment(log_state_type * const state,
+			      int32_t const mode,
+			      uint32_t const num_tests,
+			      uint32_t const num_failure_modes);
+
+// Changes a few random values, or all of them, and saves a record of
+// them to the round trip log. If fail_write, the write of the record
+// fails, so it is lost. Otherwise the record is added to those that
+// should be read back, which should be a keyframe if the segment just
+// started, the write before failed, DR_RESULTS_KEYFRAME_INTERVAL
+// records were saved since the last keyframe, or a delta would be no
+// smaller. Returns true if saving the record gave the error expected.
+static bool save_log_record(log_state_type * const state,
+			    int const iteration,
+			    bool const change_all,
+			    bool const fail_write);
+
+// Reads the round trip log back, and checks that each record read is
+// the one saved, headers included, and that the log then ends.
+static bool read_log_records(log_state_type const * const state);
+
+// Builds a small log, in the other byte order if swapped.
+static void build_small_log(small_log_type * const log, bool const swapped);
+
+// Writes the first size bytes of the bytes to the file. Returns true if
+// they were written.
+static bool write_log_file(char const * const filename,
+			   uint8_t const bytes[], uint32_t const size);
+
+// Returns true if the reader's values are the test results and failure
+// modes given.
+static bool are_log_values_equal(
+  dr_log_reader_type const * const reader,
+  uint32_t const num_tests,
+  dr_test_result_type const test_results[num_tests],
+  uint32_t const num_failure_modes,
+  dr_failure_mode_type const failure_modes[num_failure_modes]);
+
+///////////////////////////////////////////////////////
+// Public function definitions
+//////////////////////////////////////////////////////
+
+bool test_log_format(void)
+{
+  // Records are padded to whole words
+  bool test_passed = (sizeof(dr_log_record_type) == DR_LOG_RECORD_FIXED_SIZE) &&
+    (20 == dr_log_record_size(0, 0)) &&
+    (24 == dr_log_record_size(1, 0)) &&
+    (24 == dr_log_record_size(8, 8)) &&
+    (28 == dr_log_record_size(9, 8)) &&
+    (DR_LOG_MAX_RECORD_SIZE ==
+     dr_log_record_size(DR_MAX_MODEL_TESTS, DR_MAX_MODEL_FAILURE_MODES));
+
+  for(int trial = 0; (trial < NUM_LOG_TRIALS) && test_passed; ++trial)
+  {
+    static dr_test_result_type test_results[DR_MAX_MODEL_TESTS];
+    static dr_test_result_type unpacked_tests[DR_MAX_MODEL_TESTS];
+    static dr_failure_mode_type failure_modes[DR_MAX_MODEL_FAILURE_MODES];
+    static dr_failure_mode_type unpacked_failure_modes[DR_MAX_MODEL_FAILURE_MODES];
+    static uint8_t packed[DR_LOG_PACKED_BYTES(DR_MAX_MODEL_TESTS)];
+
+    uint32_t const num_tests = rand() % (DR_MAX_MODEL_TESTS + 1);
+    uint32_t const num_failure_modes = rand() % (DR_MAX_MODEL_FAILURE_MODES + 1);
+
+    for(uint32_t i = 0; i < num_tests; ++i)
+    {
+      test_results[i] = rand() % DR_TEST_RESULT_COUNT;
+    }
+    for(uint32_t i = 0; i < num_failure_modes; ++i)
+    {
+      failure_modes[i] = rand() % DR_FAILURE_MODE_COUNT;
+    }
+
+    // The bits past the last value must be clear, whatever was in the
+    // buffer
+    memset(packed, 0xFF, sizeof(packed));
+    dr_log_pack_test_results(num_tests, test_results, packed);
+    dr_log_unpack_test_results(num_tests, packed, unpacked_tests);
+    test_passed = (0 == memcmp(test_results, unpacked_tests,
+			       num_tests * sizeof(test_results[0]))) &&
+      ( (0 == (num_tests % 4)) ||
+	(0 == (packed[num_tests / 4] >> (2 * (num_tests % 4)))) );
+
+    memset(packed, 0xFF, sizeof(packed));
+    dr_log_pack_failure_modes(num_failure_modes, failure_modes, packed);
+    dr_log_unpack_failure_modes(num_failure_modes, packed,
+				unpacked_failure_modes);
+    test_passed = test_passed &&
+      (0 == memcmp(failure_modes, unpacked_failure_modes,
+		   num_failure_modes * sizeof(failure_modes[0]))) &&
+      ( (0 == (num_failure_modes % 4)) ||
+	(0 == (packed[num_failure_modes / 4] >>
+	       (2 * (num_failure_modes % 4)))) );
+  }
+
+  // Swapping twice gives back what was swapped
+  dr_log_record_type record = { DR_LOG_RECORD_TAG, -5, 0x01020304u, 7,
+				DR_ERROR_INVALID_TEST_RESULT };
+  dr_log_swap_record(&record);
+  test_passed = test_passed && (0x43525244u == record.tag) &&
+    (0x04030201u == record.seconds);
+  dr_log_swap_record(&record);
+  test_passed = test_passed && (DR_LOG_RECORD_TAG == record.tag) &&
+    (-5 == record.iteration) && (0x01020304u == record.seconds) &&
+    (7 == record.subseconds) && (DR_ERROR_INVALID_TEST_RESULT == record.error);
+
+  dr_log_header_type header;
+  memset(&header, 0, sizeof(header));
+  header.magic = DR_LOG_MAGIC;
+  header.mode = -1;
+  header.num_tests = 300;
+  dr_log_swap_header(&header);
+  test_passed = test_passed && (DR_LOG_MAGIC == dr_log_swap_uint32(header.magic));
+  dr_log_swap_header(&header);
+  test_passed = test_passed && (DR_LOG_MAGIC == header.magic) &&
+    (-1 == header.mode) && (300 == header.num_tests);
+
+  return test_passed;
+}
+
+bool test_log_deltas(void)
+{
+  bool test_passed = (DR_LOG_DELTA_FIXED_SIZE == sizeof(dr_log_delta_type)) &&
+    (24 == dr_log_delta_size(0)) &&
+    (28 == dr_log_delta_size(1)) &&
+    (28 == dr_log_delta_size(2)) &&
+    (32 == dr_log_delta_size(3));
+
+  for(int trial = 0; (trial < NUM_LOG_TRIALS) && test_passed; ++trial)
+  {
+    static dr_test_result_type test_results[DR_MAX_MODEL_TESTS];
+    static dr_test_result_type unpacked_tests[DR_MAX_MODEL_TESTS];
+    static uint8_t previous[DR_LOG_PACKED_BYTES(DR_MAX_MODEL_TESTS)];
+    static uint8_t current[DR_LOG_PACKED_BYTES(DR_MAX_MODEL_TESTS)];
+    static uint16_t changes[DR_MAX_MODEL_TESTS];
+
+    uint32_t const num_tests = 1 + (rand() % DR_MAX_MODEL_TESTS);
+    for(uint32_t i = 0; i < num_tests; ++i)
+    {
+      test_results[i] = rand() % DR_TEST_RESULT_COUNT;
+    }
+    dr_log_pack_test_results(num_tests, test_results, previous);
+
+    // Nothing changed, nothing listed
+    test_passed = (0 == dr_log_diff_packed(num_tests, previous, previous,
+					   changes));
+
+    // Change a few tests, or sometimes most of them
+    uint32_t const num_changed = (0 == (trial % 10)) ? num_tests :
+      (uint32_t)(rand() % 5);
+    for(uint32_t c = 0; c < num_changed; ++c)
+    {
+      test_results[rand() % num_tests] = rand() % DR_TEST_RESULT_COUNT;
+    }
+    dr_log_pack_test_results(num_tests, test_results, current);
+
+    // The changes are in order of index, and only of values that
+    // changed, and applying them to the previous values gives the
+    // current ones
+    uint32_t const num_changes =
+      dr_log_diff_packed(num_tests, previous, current, changes);
+    for(uint32_t c = 0; (c < num_changes) && test_passed; ++c)
+    {
+      uint32_t const index = changes[c] >> 2;
+      test_passed = (index < num_tests) &&
+	((changes[c] & 3u) == (uint32_t)test_results[index]) &&
+	( (0 == c) || ((changes[c - 1] >> 2) < index) );
+    }
+
+    test_passed = test_passed &&
+      dr_log_apply_changes(num_tests, num_changes, changes, previous) &&
+      (0 == memcmp(previous, current, DR_LOG_PACKED_BYTES(num_tests)));
+
+    dr_log_unpack_test_results(num_tests, previous, unpacked_tests);
+    test_passed = test_passed &&
+      (0 == memcmp(test_results, unpacked_tests,
+		   num_tests * sizeof(test_results[0])));
+
+    // A change past the last value isn't applied
+    uint16_t const bad_change = (uint16_t)(num_tests << 2);
+    test_passed = test_passed &&
+      !dr_log_apply_changes(num_tests, 1, &bad_change, previous) &&
+      (0 == memcmp(previous, current, DR_LOG_PACKED_BYTES(num_tests)));
+  }
+
+  // Swapping a delta twice gives it back
+  dr_log_delta_type delta = { DR_LOG_DELTA_TAG, 12, 3, 4,
+			      DR_ERROR_NO_ERROR, 0x0102, 7 };
+  dr_log_swap_delta(&delta);
+  test_passed = test_passed && (0x0201 == delta.num_test_changes);
+  dr_log_swap_delta(&delta);
+  test_passed = test_passed && (DR_LOG_DELTA_TAG == delta.tag) &&
+    (12 == delta.iteration) && (0x0102 == delta.num_test_changes) &&
+    (7 == delta.num_failure_mode_changes);
+
+  return test_passed;
+}
+
+bool test_log_round_trip(void)
+{
+  static log_state_type state;
+  memset(&state, 0, sizeof(state));
+
+  bool test_passed = (DR_ERROR_NO_ERROR == dr_open_results_log(LOG_FILENAME));
+
+  // A model big enough that a delta of every value is bigger than a
+  // keyframe, for long enough to reach the keyframe interval twice,
+  // with one record whose write fails.
+  test_passed = test_passed &&
+    start_log_segment(&state, 1, LOG_TESTS, LOG_FAILURE_MODES);
+
+  int iteration = 0;
+  for(int i = 0; (i < NUM_FIRST_SEGMENT_RECORDS) && test_passed; ++i)
+  {
+    test_passed = save_log_record(&state, iteration++,
+				  (ALL_CHANGED_RECORD == i),
+				  (FAILED_WRITE_RECORD == i));
+  }
+
+  // A mode change to a smaller model starts a new segment
+  test_passed = test_passed &&
+    start_log_segment(&state, 2, LOG_SECOND_TESTS, LOG_SECOND_FAILURE_MODES);
+
+  for(int i = 0; (i < NUM_SECOND_SEGMENT_RECORDS) && test_passed; ++i)
+  {
+    test_passed = save_log_record(&state, iteration++, false, false);
+  }
+
+  test_passed = (DR_ERROR_NO_ERROR == dr_close_results_log()) &&
+    test_passed && read_log_records(&state);
+
+  remove(LOG_FILENAME);
+
+  return test_passed;
+}
+
+bool test_log_reader(void)
+{
+  static small_log_type log;
+  static dr_log_reader_type reader;
+  bool test_passed = true;
+
+  // Either byte order reads the same
+  for(int swapped = 0; (swapped < 2) && test_passed; ++swapped)
+  {
+    build_small_log(&log, swapped);
+    test_passed =
+      write_log_file(LOG_FILENAME, log.bytes,
+		     log.header_size + log.keyframe_size + log.delta_size) &&
+      dr_log_open(&reader, LOG_FILENAME);
+
+    test_passed = test_passed &&
+      (DR_LOG_READ_RECORD == dr_log_read(&reader)) &&
+      reader.new_segment && reader.keyframe &&
+      (reader.swapped == (bool)swapped) &&
+      (5 == reader.header.mode) &&
+      (0x12345678u == reader.header.d_matrix_crc) &&
+      (0 == strcmp("/cf/dr_wtm.tbl", reader.header.wtm_tbl_filename)) &&
+      (1 == reader.record.iteration) && (100 == reader.record.seconds) &&
+      are_log_values_equal(&reader,
+			   SMALL_LOG_TESTS, log.keyframe_tests,
+			   SMALL_LOG_FAILURE_MODES, log.keyframe_failure_modes);
+
+    test_passed = test_passed &&
+      (DR_LOG_READ_RECORD == dr_log_read(&reader)) &&
+      !reader.new_segment && !reader.keyframe &&
+      (2 == reader.record.iteration) && (101 == reader.record.seconds) &&
+      are_log_values_equal(&reader,
+			   SMALL_LOG_TESTS, log.delta_tests,
+			   SMALL_LOG_FAILURE_MODES, log.delta_failure_modes);
+
+    test_passed = test_passed && (DR_LOG_READ_END == dr_log_read(&reader)) &&
+      (2 == reader.num_records);
+    dr_log_close(&reader);
+  }
+
+  // Part of a record at the end is dropped
+  build_small_log(&log, false);
+  test_passed = test_passed &&
+    write_log_file(LOG_FILENAME, log.bytes,
+		   log.header_size + log.keyframe_size + log.delta_size - 2) &&
+    dr_log_open(&reader, LOG_FILENAME) &&
+    (DR_LOG_READ_RECORD == dr_log_read(&reader)) &&
+    (DR_LOG_READ_PARTIAL == dr_log_read(&reader)) &&
+    (1 == reader.num_records);
+  dr_log_close(&reader);
+
+  // A delta with no keyframe before it can't be read
+  memmove(&log.bytes[log.header_size],
+	  &log.bytes[log.header_size + log.keyframe_size], log.delta_size);
+  test_passed = test_passed &&
+    write_log_file(LOG_FILENAME, log.bytes, log.header_size + log.delta_size) &&
+    dr_log_open(&reader, LOG_FILENAME) &&
+    (DR_LOG_READ_BAD == dr_log_read(&reader));
+  dr_log_close(&reader);
+
+  // Nor can something that isn't a log
+  static uint8_t const not_a_log[] = "DR test results, CSV\n";
+  test_passed = test_passed &&
+    write_log_file(LOG_FILENAME, not_a_log, sizeof(not_a_log)) &&
+    dr_log_open(&reader, LOG_FILENAME) &&
+    (DR_LOG_READ_BAD == dr_log_read(&reader));
+  dr_log_close(&reader);
+
+  remove(LOG_FILENAME);
+
+  return test_passed;
+}
+
+///////////////////////////////////////////////////////
+// Private function definitions
+//////////////////////////////////////////////////////
+
+static bool start_log_segment(log_state_type * const state,
+			      int32_t const mode,
+			      uint32_t const num_tests,
+			      uint32_t const num_failure_modes)
+{
+  dr_log_header_type * const header = &state->headers[state->num_segments];
+  memset(header, 0, sizeof(*header));
+  header->num_tests = num_tests;
+  header->num_failure_modes = num_failure_modes;
+  header->mode = mode;
+  header->d_matrix_crc = (uint32_t)rand();
+  header->wtm_crc = (uint32_t)rand();
+  snprintf(header->d_matrix_tbl_filename, DR_LOG_FILENAME_LENGTH,
+	   "/cf/dr_d_matrix_%d.tbl", (int)mode);
+  snprintf(header->wtm_tbl_filename, DR_LOG_FILENAME_LENGTH,
+	   "/cf/dr_wtm_%d.tbl", (int)mode);
+
+  state->num_segments++;
+  state->num_tests = num_tests;
+  state->num_failure_modes = num_failure_modes;
+  state->new_segment = true;
+  state->keyframe_needed = true;
+
+  for(uint32_t i = 0; i < num_tests; ++i)
+  {
+    state->test_results[i] = rand() % DR_TEST_RESULT_COUNT;
+  }
+  for(uint32_t i = 0; i < num_failure_modes; ++i)
+  {
+    state->failure_modes[i] = rand() % DR_FAILURE_MODE_COUNT;
+  }
+
+  return (DR_ERROR_NO_ERROR == dr_save_results_log_header(header));
+}
+
+static bool save_log_record(log_state_type * const state,
+			    int const iteration,
+			    bool const change_all,
+			    bool const fail_write)
+{
+  uint32_t const num_tests = state->num_tests;
+  uint32_t const num_failure_modes = state->num_failure_modes;
+  uint32_t const num_values = num_tests + num_failure_modes;
+  dr_test_result_type previous_tests[LOG_TESTS];
+  dr_failure_mode_type previous_failure_modes[LOG_FAILURE_MODES];
+
+  memcpy(previous_tests, state->test_results, sizeof(previous_tests));
+  memcpy(previous_failure_modes, state->failure_modes,
+	 sizeof(previous_failure_modes));
+
+  // Change every value to another, or up to 4 random ones
+  uint32_t const num_changes = change_all ? num_values : (uint32_t)(rand() % 5);
+  for(uint32_t c = 0; c < num_changes; ++c)
+  {
+    uint32_t const index = change_all ? c : (uint32_t)(rand() % num_values);
+
+    if(index < num_tests)
+    {
+      state->test_results[index] = (state->test_results[index] + 1 +
+	(rand() % (DR_TEST_RESULT_COUNT - 1))) % DR_TEST_RESULT_COUNT;
+    }
+    else
+    {
+      uint32_t const f = index - num_tests;
+      state->failure_modes[f] = (state->failure_modes[f] + 1 +
+	(rand() % (DR_FAILURE_MODE_COUNT - 1))) % DR_FAILURE_MODE_COUNT;
+    }
+  }
+
+  // A value changed twice may be back where it was
+  uint32_t num_changed = 0;
+  for(uint32_t i = 0; i < num_tests; ++i)
+  {
+    num_changed += (previous_tests[i] != state->test_results[i]) ? 1 : 0;
+  }
+  for(uint32_t i = 0; i < num_failure_modes; ++i)
+  {
+    num_changed +=
+      (previous_failure_modes[i] != state->failure_modes[i]) ? 1 : 0;
+  }
+
+  bool const keyframe = state->keyframe_needed ||
+    (state->records_since_keyframe >= DR_RESULTS_KEYFRAME_INTERVAL) ||
+    (dr_log_delta_size(num_changed) >=
+     dr_log_record_size(num_tests, num_failure_modes));
+
+  dr_error_type const error = (7 == (iteration % 50)) ?
+    DR_ERROR_INVALID_TEST_RESULT : DR_ERROR_NO_ERROR;
+
+  if(fail_write)
+  {
+    dr_test_fail_os_writes(1);
+  }
+
+  dr_error_type const save_error =
+    dr_save_results_log(iteration, 1000 + iteration, 7 * iteration, error,
+			num_tests, state->test_results,
+			num_failure_modes, state->failure_modes);
+
+  // With DR_RESULTS_FLUSH_ROWS at 1, as the unit tests build it, each
+  // record is written as it is saved
+  if(fail_write)
+  {
+    state->keyframe_needed = true;
+  }
+  else
+  {
+    log_record_type * const record = &state->records[state->num_records++];
+    record->iteration = iteration;
+    record->error = error;
+    record->keyframe = keyframe;
+    record->new_segment = state->new_segment;
+    record->segment = state->num_segments - 1;
+    memcpy(record->test_results, state->test_results,
+	   sizeof(record->test_results));
+    memcpy(record->failure_modes, state->failure_modes,
+	   sizeof(record->failure_modes));
+
+    state->new_segment = false;
+    state->keyframe_needed = false;
+    state->records_since_keyframe =
+      keyframe ? 1 : (state->records_since_keyframe + 1);
+  }
+
+  return fail_write ? (DR_ERROR_SAVE_ERROR == save_error) :
+    (DR_ERROR_NO_ERROR == save_error);
+}
+
+static bool read_log_records(log_state_type const * const state)
+{
+  static dr_log_reader_type reader;
+  bool test_passed = dr_log_open(&reader, LOG_FILENAME);
+
+  for(uint32_t r = 0; (r < state->num_records) && test_passed; ++r)
+  {
+    log_record_type const * const record = &state->records[r];
+    dr_log_header_type const * const header = &state->headers[record->segment];
+
+    test_passed = (DR_LOG_READ_RECORD == dr_log_read(&reader)) &&
+      (record->new_segment == reader.new_segment) &&
+      (record->keyframe == reader.keyframe) &&
+      (record->iteration == reader.record.iteration) &&
+      ((uint32_t)(1000 + record->iteration) == reader.record.seconds) &&
+      ((uint32_t)(7 * record->iteration) == reader.record.subseconds) &&
+      ((int32_t)record->error == reader.record.error) &&
+      (DR_LOG_VERSION == reader.header.version) &&
+      (header->mode == reader.header.mode) &&
+      (header->d_matrix_crc == reader.header.d_matrix_crc) &&
+      (header->wtm_crc == reader.header.wtm_crc) &&
+      (0 == strcmp(header->d_matrix_tbl_filename,
+		   reader.header.d_matrix_tbl_filename)) &&
+      (0 == strcmp(header->wtm_tbl_filename,
+		   reader.header.wtm_tbl_filename)) &&
+      are_log_values_equal(&reader,
+			   header->num_tests, record->test_results,
+			   header->num_failure_modes, record->failure_modes);
+  }
+
+  test_passed = test_passed && (DR_LOG_READ_END == dr_log_read(&reader)) &&
+    (state->num_records == reader.num_records);
+  dr_log_close(&reader);
+
+  return test_passed;
+}
+
+static void build_small_log(small_log_type * const log, bool const swapped)
+{
+  memset(log, 0, sizeof(*log));
+
+  dr_log_header_type header;
+  memset(&header, 0, sizeof(header));
+  header.magic = DR_LOG_MAGIC;
+  header.version = DR_LOG_VERSION;
+  header.header_size = sizeof(header);
+  header.record_size = dr_log_record_size(SMALL_LOG_TESTS,
+					  SMALL_LOG_FAILURE_MODES);
+  header.num_tests = SMALL_LOG_TESTS;
+  header.num_failure_modes = SMALL_LOG_FAILURE_MODES;
+  header.mode = 5;
+  header.d_matrix_crc = 0x12345678u;
+  strcpy(header.d_matrix_tbl_filename, "/cf/dr_d_matrix.tbl");
+  strcpy(header.wtm_tbl_filename, "/cf/dr_wtm.tbl");
+
+  for(uint32_t i = 0; i < SMALL_LOG_TESTS; ++i)
+  {
+    log->keyframe_tests[i] = rand() % DR_TEST_RESULT_COUNT;
+  }
+  for(uint32_t i = 0; i < SMALL_LOG_FAILURE_MODES; ++i)
+  {
+    log->keyframe_failure_modes[i] = rand() % DR_FAILURE_MODE_COUNT;
+  }
+
+  dr_log_record_type record =
+    { DR_LOG_RECORD_TAG, 1, 100, 0, DR_ERROR_NO_ERROR };
+  uint32_t const num_test_bytes = DR_LOG_PACKED_BYTES(SMALL_LOG_TESTS);
+  uint8_t packed[DR_LOG_PACKED_BYTES(SMALL_LOG_TESTS) +
+		 DR_LOG_PACKED_BYTES(SMALL_LOG_FAILURE_MODES)];
+  dr_log_pack_test_results(SMALL_LOG_TESTS, log->keyframe_tests, packed);
+  dr_log_pack_failure_modes(SMALL_LOG_FAILURE_MODES,
+			    log->keyframe_failure_modes,
+			    &packed[num_test_bytes]);
+
+  // The delta changes test 3 and failure mode 2 to other values
+  memcpy(log->delta_tests, log->keyframe_tests, sizeof(log->delta_tests));
+  memcpy(log->delta_failure_modes, log->keyframe_failure_modes,
+	 sizeof(log->delta_failure_modes));
+  log->delta_tests[3] = (log->delta_tests[3] + 1) % DR_TEST_RESULT_COUNT;
+  log->delta_failure_modes[2] =
+    (log->delta_failure_modes[2] + 1) % DR_FAILURE_MODE_COUNT;
+
+  dr_log_delta_type delta =
+    { DR_LOG_DELTA_TAG, 2, 101, 0, DR_ERROR_NO_ERROR, 1, 1 };
+  uint16_t changes[2] =
+    { (uint16_t)((3 << 2) | log->delta_tests[3]),
+      (uint16_t)((2 << 2) | log->delta_failure_modes[2]) };
+
+  if(swapped)
+  {
+    dr_log_swap_header(&header);
+    dr_log_swap_record(&record);
+    dr_log_swap_delta(&delta);
+    changes[0] = dr_log_swap_uint16(changes[0]);
+    changes[1] = dr_log_swap_uint16(changes[1]);
+  }
+
+  // The padding after each record stays clear
+  log->header_size = sizeof(header);
+  log->keyframe_size = dr_log_record_size(SMALL_LOG_TESTS,
+					  SMALL_LOG_FAILURE_MODES);
+  log->delta_size = dr_log_delta_size(2);
+
+  uint8_t * bytes = log->bytes;
+  memcpy(bytes, &header, sizeof(header));
+  bytes += log->header_size;
+  memcpy(bytes, &record, sizeof(record));
+  memcpy(&bytes[sizeof(record)], packed, sizeof(packed));
+  bytes += log->keyframe_size;
+  memcpy(bytes, &delta, sizeof(delta));
+  memcpy(&bytes[sizeof(delta)], changes, sizeof(changes));
+}
+
+static bool write_log_file(char const * const filename,
+			   uint8_t const bytes[], uint32_t const size)
+{
+  FILE * const file = fopen(filename, "wb");
+  bool written = (NULL != file) && (size == fwrite(bytes, 1, size, file));
+
+  if(NULL != file)
+  {
+    written = (0 == fclose(file)) && written;
+  }
+
+  return written;
+}
+
+static bool are_log_values_equal(
+  dr_log_reader_type const * const reader,
+  uint32_t const num_tests,
+  dr_test_result_type const test_results[num_tests],
+  uint32_t const num_failure_modes,
+  dr_failure_mode_type const failure_modes[num_failure_modes])
+{
+  return (num_tests == reader->header.num_tests) &&
+    (num_failure_modes == reader->header.num_failure_modes) &&
+    (0 == memcmp(test_results, reader->test_results,
+		 num_tests * sizeof(test_results[0]))) &&
+    (0 == memcmp(failure_modes, reader->failure_modes,
+		 num_failure_modes * sizeof(failure_modes[0])));
+}
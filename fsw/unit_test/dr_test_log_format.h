@@ -0,0 +1,52 @@
+#ifndef DR_TEST_LOG_FORMAT_H
+#define DR_TEST_LOG_FORMAT_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//////////////////////////////////////////////
+// Public functions
+///////////////////////////////////////////////
+
+// For random test results and failure modes of random model sizes,
+// checks that packing them for the binary diagnosis log and unpacking
+// them gives them back, with the bits past the last value clear. Also
+// checks the record sizes, and that swapping the byte order of a
+// header or record twice gives it back.
+// Returns true if the test passed; false otherwise.
+bool test_log_format(void);
+
+// For random test results of random model sizes, changes a few of
+// them, or most, and checks that the changes listed for a delta record
+// of the binary diagnosis log are those in order, and that applying
+// them to the values before gives the values after. Also checks that a
+// change past the last value is refused.
+// Returns true if the test passed; false otherwise.
+bool test_log_deltas(void);
+
+// Saves a binary diagnosis log of two segments with
+// dr_save_results_log(), a few values changing from record to record,
+// and reads it back with the log reader. Checks that every record
+// reads back with its values and the header of its segment, and that
+// the records are keyframes where they should be: at the start of each
+// segment, every DR_RESULTS_KEYFRAME_INTERVAL records, after a record
+// whose write failed, and when all the values change, so a delta would
+// be no smaller.
+// Returns true if the test passed; false otherwise.
+bool test_log_round_trip(void);
+
+// Reads logs built by hand, in both byte orders, and checks the values
+// rebuilt from a keyframe and a delta after it. Also checks that part
+// of a record at the end is dropped, and that a delta with no keyframe
+// before it, or a file that isn't a log, can't be read.
+// Returns true if the test passed; false otherwise.
+bool test_log_reader(void);
+
+#ifdef __cplusplus
+}  // extern "C" {
+#endif
+
+#endif // DR_TEST_LOG_FORMAT_H
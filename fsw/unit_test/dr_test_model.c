@@ -0,0 +1,577 @@
+#include "dr_test_model.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "dr_gather_plan.h"
+#include "dr_model.h"
+
+///////////////////////////////////////////////////////
+// Constants
+//////////////////////////////////////////////////////
+
+#define NUM_GATHER_TRIALS 200
+#define NUM_MODEL_TRIALS 100
+
+// The watchpoints of the watchpoint results table, and the most mapping
+// entries of the random mappings
+#define NUM_WATCHPOINTS 176
+#define MAX_WTM_ENTRIES 300
+
+// The largest model the model storage holds, smaller than the largest
+// model size so that a d-matrix too big for the storage can be tried
+#define MODEL_MAX_TESTS 128
+#define MODEL_MAX_FAILURE_MODES 96
+#define MODEL_MAX_NONZEROS (MODEL_MAX_TESTS * MODEL_MAX_FAILURE_MODES)
+
+///////////////////////////////////////////////////////
+// Private function declarations
+//////////////////////////////////////////////////////
+
+// Fills the mapping with random entries, roughly active_percent of
+// them active, reading random watchpoints.
+static void randomize_wtm(uint32_t const num_entries,
+			  dr_wtm_entry_type wtm[num_entries],
+			  int const active_percent);
+
+// Gathers the watch results of the plan's watchpoints into its slots,
+// as dr_process_tests() does from the watchpoint results table, then
+// checks the plan against the mapping it was compiled from and the
+// watch results looked up by watchpoint.
+static bool is_gather_plan_valid(dr_gather_plan_type const * const plan,
+				 uint32_t const num_entries,
+				 dr_wtm_entry_type const wtm[num_entries],
+				 uint8_t const watch_results[NUM_WATCHPOINTS]);
+
+// Gives the model its storage, and leaves it empty.
+static void init_model(dr_model_type * const model);
+
+// Fills the packed d-matrix table with a random d-matrix of the given
+// size, with roughly density_percent of the entries set.
+static void randomize_packed_d_matrix(
+  dr_d_matrix_packed_tbl_type * const packed_tbl,
+  uint32_t const num_tests, uint32_t const num_failure_modes,
+  int const density_percent);
+
+// Fills the whole mapping table with valid active entries, each mapping
+// to one of num_tests tests.
+static void fill_valid_wtm(dr_wtm_entry_type wtm[DR_MAX_MODEL_TESTS],
+			   uint32_t const num_tests);
+
+// Returns true if the model is empty with the given error.
+static bool is_model_empty(dr_model_type const * const model,
+			   dr_error_type const error);
+
+// Returns true if the model holds the packed d-matrix, in its bitsets,
+// sparse d-matrix, and components.
+static bool is_model_d_matrix_equal(
+  dr_model_type const * const model,
+  dr_d_matrix_packed_tbl_type const * const packed_tbl);
+
+// The plan's storage, sized for the largest model
+static uint32_t plan_watchpoints[NUM_WATCHPOINTS];
+static dr_gather_test_type plan_tests[DR_MAX_MODEL_TESTS];
+static dr_gather_slot_type plan_clear_slots[DR_MAX_MODEL_TESTS * DR_MAX_CLEAR_CONDS];
+
+// The model, its storage, and its tables are large enough that we keep
+// them off the stack.
+static dr_model_type model;
+static dr_d_matrix_packed_tbl_type packed_tbl;
+static dr_wtm_entry_type model_wtm[DR_MAX_MODEL_TESTS];
+static dr_bitset_word_type
+  model_rows[DR_BITSET_ROW_STORAGE_WORDS(MODEL_MAX_TESTS,
+					 MODEL_MAX_FAILURE_MODES)];
+static dr_bitset_word_type
+  model_cols[DR_BITSET_COL_STORAGE_WORDS(MODEL_MAX_TESTS,
+					 MODEL_MAX_FAILURE_MODES)];
+static dr_sparse_offset_type model_row_starts[MODEL_MAX_FAILURE_MODES + 1];
+static dr_sparse_index_type model_row_tests[MODEL_MAX_NONZEROS];
+static dr_sparse_offset_type model_col_starts[MODEL_MAX_TESTS + 1];
+static dr_sparse_index_type model_col_failure_modes[MODEL_MAX_NONZEROS];
+static dr_components_type model_components;
+static uint32_t model_gather_watchpoints[NUM_WATCHPOINTS];
+static dr_gather_test_type model_gather_tests[MODEL_MAX_TESTS];
+static dr_gather_slot_type
+  model_gather_clear_slots[MODEL_MAX_TESTS * DR_MAX_CLEAR_CONDS];
+
+///////////////////////////////////////////////////////
+// Public function definitions
+//////////////////////////////////////////////////////
+
+bool test_gather_plan(void)
+{
+  static dr_wtm_entry_type wtm[MAX_WTM_ENTRIES];
+  uint8_t watch_results[NUM_WATCHPOINTS] = { 0 };
+
+  dr_gather_plan_type plan = { NUM_WATCHPOINTS, 0, plan_watchpoints, 0,
+			       plan_tests, plan_clear_slots };
+
+  // A mapping with no active tests reads no watchpoints
+  randomize_wtm(MAX_WTM_ENTRIES, wtm, 0);
+  dr_compile_gather_plan(&plan, MAX_WTM_ENTRIES, wtm);
+  bool test_passed = (0 == plan.num_slots) && (0 == plan.num_tests) &&
+    (DR_GATHER_NO_SLOT == dr_find_gather_slot(&plan, 0));
+
+  for(int trial = 0; (trial < NUM_GATHER_TRIALS) && test_passed; ++trial)
+  {
+    // Small mappings leave most watchpoints out of the plan, big ones
+    // read most of them
+    uint32_t const num_entries = 1 + (rand() % MAX_WTM_ENTRIES);
+    randomize_wtm(num_entries, wtm, rand() % 101);
+
+    // Distinct watch results, so a test only finds the one it looks up
+    // in the right slot
+    for(uint32_t w = 0; w < NUM_WATCHPOINTS; ++w)
+    {
+      uint32_t const other = rand() % (w + 1);
+      watch_results[w] = watch_results[other];
+      watch_results[other] = (uint8_t)w;
+    }
+
+    dr_compile_gather_plan(&plan, num_entries, wtm);
+    test_passed = is_gather_plan_valid(&plan, num_entries, wtm, watch_results);
+  }
+
+  return test_passed;
+}
+
+bool test_model_validation(void)
+{
+  init_model(&model);
+  bool test_passed = is_model_empty(&model, DR_ERROR_INVALID_D_MATRIX);
+
+  // The d-matrix header must be of the packed format, and no bigger
+  // than the largest model
+  randomize_packed_d_matrix(&packed_tbl, MODEL_MAX_TESTS,
+			    MODEL_MAX_FAILURE_MODES, 10);
+  test_passed = test_passed &&
+    (DR_ERROR_NO_ERROR == dr_validate_d_matrix_tbl(&packed_tbl));
+
+  packed_tbl.header.format = DR_D_MATRIX_PACKED_FORMAT + 1;
+  test_passed = test_passed &&
+    (DR_ERROR_INVALID_D_MATRIX == dr_validate_d_matrix_tbl(&packed_tbl));
+
+  packed_tbl.header.format = DR_D_MATRIX_PACKED_FORMAT;
+  packed_tbl.header.num_tests = DR_MAX_MODEL_TESTS + 1;
+  test_passed = test_passed &&
+    (DR_ERROR_INVALID_D_MATRIX == dr_validate_d_matrix_tbl(&packed_tbl));
+
+  packed_tbl.header.num_tests = DR_MAX_MODEL_TESTS;
+  packed_tbl.header.num_failure_modes = DR_MAX_MODEL_FAILURE_MODES + 1;
+  test_passed = test_passed &&
+    (DR_ERROR_INVALID_D_MATRIX == dr_validate_d_matrix_tbl(&packed_tbl));
+
+  packed_tbl.header.num_failure_modes = DR_MAX_MODEL_FAILURE_MODES;
+  test_passed = test_passed &&
+    (DR_ERROR_NO_ERROR == dr_validate_d_matrix_tbl(&packed_tbl));
+
+  // A refused d-matrix, or one too big for the storage, empties a
+  // compiled model
+  fill_valid_wtm(model_wtm, MODEL_MAX_TESTS);
+  randomize_packed_d_matrix(&packed_tbl, MODEL_MAX_TESTS,
+			    MODEL_MAX_FAILURE_MODES, 10);
+  test_passed = test_passed &&
+    (DR_ERROR_NO_ERROR == dr_compile_model(&model, &packed_tbl, model_wtm)) &&
+    (MODEL_MAX_TESTS == model.num_tests);
+
+  packed_tbl.header.format = 0;
+  test_passed = test_passed &&
+    (DR_ERROR_INVALID_D_MATRIX ==
+     dr_compile_model(&model, &packed_tbl, model_wtm)) &&
+    is_model_empty(&model, DR_ERROR_INVALID_D_MATRIX);
+
+  randomize_packed_d_matrix(&packed_tbl, MODEL_MAX_TESTS + 1,
+			    MODEL_MAX_FAILURE_MODES, 10);
+  test_passed = test_passed &&
+    (DR_ERROR_WRONG_NUM_TESTS ==
+     dr_compile_model(&model, &packed_tbl, model_wtm)) &&
+    is_model_empty(&model, DR_ERROR_WRONG_NUM_TESTS);
+
+  randomize_packed_d_matrix(&packed_tbl, MODEL_MAX_TESTS,
+			    MODEL_MAX_FAILURE_MODES + 1, 10);
+  test_passed = test_passed &&
+    (DR_ERROR_WRONG_NUM_FAILURE_MODES ==
+     dr_compile_model(&model, &packed_tbl, model_wtm)) &&
+    is_model_empty(&model, DR_ERROR_WRONG_NUM_FAILURE_MODES);
+
+  // Each active mapping entry out of range is refused, by the
+  // validation and by the compile, wherever it is in the table
+  randomize_packed_d_matrix(&packed_tbl, MODEL_MAX_TESTS,
+			    MODEL_MAX_FAILURE_MODES, 10);
+
+  for(int bad = 0; (bad < 7) && test_passed; ++bad)
+  {
+    uint32_t const i = rand() % DR_MAX_MODEL_TESTS;
+    dr_wtm_entry_type * const entry = &model_wtm[i];
+
+    fill_valid_wtm(model_wtm, MODEL_MAX_TESTS);
+    test_passed =
+      (DR_ERROR_NO_ERROR ==
+       dr_compile_model(&model, &packed_tbl, model_wtm));
+
+    switch(bad)
+    {
+    case 0:
+      entry->test_index = DR_MAX_MODEL_TESTS;
+      break;
+    case 1:
+      entry->watchpoint_index = NUM_WATCHPOINTS;
+      break;
+    case 2:
+      entry->test_valid_watchpoint_index = NUM_WATCHPOINTS;
+      break;
+    case 3:
+      entry->test_type = DR_STALENESS_TEST + 1;
+      break;
+    case 4:
+      entry->test_latching = true;
+      entry->latch_clear.latch_clear_count = DR_MAX_CLEAR_CONDS + 1;
+      break;
+    case 5:
+      entry->test_latching = true;
+      entry->latch_clear.latch_clear_count = DR_MAX_CLEAR_CONDS;
+      entry->latch_clear.latch_clear_indices[DR_MAX_CLEAR_CONDS - 1] =
+	NUM_WATCHPOINTS;
+      break;
+    default:
+      entry->watchpoint_index = UINT32_MAX;
+      break;
+    }
+
+    test_passed = test_passed &&
+      (DR_ERROR_INVALID_WTM ==
+       dr_validate_wtm_tbl(NUM_WATCHPOINTS, DR_MAX_MODEL_TESTS, model_wtm)) &&
+      (DR_ERROR_INVALID_WTM ==
+       dr_compile_model(&model, &packed_tbl, model_wtm)) &&
+      is_model_empty(&model, DR_ERROR_INVALID_WTM);
+
+    // The same entry inactive isn't checked, and neither are the latch
+    // clear watchpoints of a plain test
+    entry->test_active = false;
+    test_passed = test_passed &&
+      (DR_ERROR_NO_ERROR ==
+       dr_validate_wtm_tbl(NUM_WATCHPOINTS, DR_MAX_MODEL_TESTS, model_wtm));
+
+    entry->test_active = true;
+    entry->test_latching = false;
+    test_passed = test_passed &&
+      (((bad == 4) || (bad == 5)) ==
+       (DR_ERROR_NO_ERROR ==
+	dr_validate_wtm_tbl(NUM_WATCHPOINTS, DR_MAX_MODEL_TESTS, model_wtm)));
+  }
+
+  // The last test and watchpoints are allowed, and so is no validity
+  // watchpoint
+  fill_valid_wtm(model_wtm, MODEL_MAX_TESTS);
+  model_wtm[0].test_index = MODEL_MAX_TESTS - 1;
+  model_wtm[0].watchpoint_index = NUM_WATCHPOINTS - 1;
+  model_wtm[0].test_valid_watchpoint_index = UINT32_MAX;
+  model_wtm[0].test_latching = true;
+  model_wtm[0].latch_clear.latch_clear_count = 1;
+  model_wtm[0].latch_clear.latch_clear_indices[0] = NUM_WATCHPOINTS - 1;
+  test_passed = test_passed &&
+    (DR_ERROR_NO_ERROR ==
+     dr_compile_model(&model, &packed_tbl, model_wtm));
+
+  // An entry of one of the model's tests must map to one of its tests,
+  // which only the compile knows. Entries past the model's tests may
+  // map to any test.
+  randomize_packed_d_matrix(&packed_tbl, MODEL_MAX_TESTS / 2,
+			    MODEL_MAX_FAILURE_MODES, 10);
+  fill_valid_wtm(model_wtm, MODEL_MAX_TESTS / 2);
+  model_wtm[MODEL_MAX_TESTS / 2].test_index = MODEL_MAX_TESTS;
+  test_passed = test_passed &&
+    (DR_ERROR_NO_ERROR ==
+     dr_compile_model(&model, &packed_tbl, model_wtm));
+
+  model_wtm[(MODEL_MAX_TESTS / 2) - 1].test_index = MODEL_MAX_TESTS / 2;
+  test_passed = test_passed &&
+    (DR_ERROR_NO_ERROR ==
+     dr_validate_wtm_tbl(NUM_WATCHPOINTS, DR_MAX_MODEL_TESTS, model_wtm)) &&
+    (DR_ERROR_INVALID_WTM ==
+     dr_compile_model(&model, &packed_tbl, model_wtm)) &&
+    is_model_empty(&model, DR_ERROR_INVALID_WTM);
+
+  return test_passed;
+}
+
+bool test_model_compile(void)
+{
+  uint8_t watch_results[NUM_WATCHPOINTS];
+  bool test_passed = true;
+
+  init_model(&model);
+
+  for(uint32_t w = 0; w < NUM_WATCHPOINTS; ++w)
+  {
+    watch_results[w] = (uint8_t)w;
+  }
+
+  for(int trial = 0; (trial < NUM_MODEL_TRIALS) && test_passed; ++trial)
+  {
+    uint32_t const num_tests = 1 + (rand() % MODEL_MAX_TESTS);
+    uint32_t const num_failure_modes = 1 + (rand() % MODEL_MAX_FAILURE_MODES);
+
+    randomize_packed_d_matrix(&packed_tbl, num_tests, num_failure_modes,
+			      1 + (trial % 40));
+    memset(model_wtm, 0, sizeof(model_wtm));
+    randomize_wtm(num_tests, model_wtm, rand() % 101);
+
+    // Every few trials, refuse a compile first, which the next compile
+    // must recover from
+    if(0 == (trial % 4))
+    {
+      model_wtm[0].test_active = true;
+      model_wtm[0].test_index = num_tests;
+      test_passed =
+	(DR_ERROR_INVALID_WTM ==
+	 dr_compile_model(&model, &packed_tbl, model_wtm)) &&
+	is_model_empty(&model, DR_ERROR_INVALID_WTM);
+      model_wtm[0].test_index = 0;
+    }
+
+    test_passed = test_passed &&
+      (DR_ERROR_NO_ERROR ==
+       dr_compile_model(&model, &packed_tbl, model_wtm)) &&
+      (DR_ERROR_NO_ERROR == model.error) &&
+      (DR_ERROR_NO_ERROR == model.sparse_error) &&
+      (num_tests == model.num_tests) &&
+      (num_failure_modes == model.num_failure_modes) &&
+      is_model_d_matrix_equal(&model, &packed_tbl) &&
+      is_gather_plan_valid(&(model.gather_plan), num_tests, model_wtm,
+			   watch_results);
+  }
+
+  return test_passed;
+}
+
+///////////////////////////////////////////////////////
+// Private function definitions
+//////////////////////////////////////////////////////
+
+static void randomize_wtm(uint32_t const num_entries,
+			  dr_wtm_entry_type wtm[num_entries],
+			  int const active_percent)
+{
+  for(uint32_t i = 0; i < num_entries; ++i)
+  {
+    dr_wtm_entry_type * const entry = &wtm[i];
+
+    memset(entry, 0, sizeof(*entry));
+    entry->test_index = rand() % num_entries;
+    entry->watchpoint_index = rand() % NUM_WATCHPOINTS;
+    entry->test_active = ((rand() % 100) < active_percent);
+    entry->test_valid_watchpoint_index =
+      (0 == (rand() % 2)) ? UINT32_MAX : (uint32_t)(rand() % NUM_WATCHPOINTS);
+    entry->test_latching = (0 == (rand() % 3));
+    entry->test_type = (0 == (rand() % 2)) ? DR_VALUE_TEST : DR_STALENESS_TEST;
+
+    // Inactive and plain tests may still list latch clear watchpoints,
+    // which the plan must not read for them
+    entry->latch_clear.latch_clear_count = rand() % (DR_MAX_CLEAR_CONDS + 1);
+    for(uint32_t k = 0; k < entry->latch_clear.latch_clear_count; ++k)
+    {
+      entry->latch_clear.latch_clear_indices[k] = rand() % NUM_WATCHPOINTS;
+    }
+  }
+}
+
+static bool is_gather_plan_valid(dr_gather_plan_type const * const plan,
+				 uint32_t const num_entries,
+				 dr_wtm_entry_type const wtm[num_entries],
+				 uint8_t const watch_results[NUM_WATCHPOINTS])
+{
+  uint8_t gather_buffer[NUM_WATCHPOINTS];
+  bool used[NUM_WATCHPOINTS] = { false };
+  uint32_t num_active = 0;
+
+  for(uint32_t k = 0; k < plan->num_slots; ++k)
+  {
+    gather_buffer[k] = watch_results[plan->watchpoints[k]];
+  }
+
+  // Each active test finds the watch results it would have looked up
+  bool valid = (plan->num_slots <= NUM_WATCHPOINTS);
+
+  for(uint32_t i = 0; (i < num_entries) && valid; ++i)
+  {
+    dr_wtm_entry_type const * const entry = &wtm[i];
+
+    if(entry->test_active)
+    {
+      dr_gather_test_type const * const test = &plan->tests[num_active++];
+
+      valid = (num_active <= plan->num_tests) &&
+	(test->test_index == entry->test_index) &&
+	(test->entry_index == i) &&
+	(test->test_type == entry->test_type) &&
+	(test->value_slot < plan->num_slots) &&
+	(gather_buffer[test->value_slot] ==
+	 watch_results[entry->watchpoint_index]);
+      used[entry->watchpoint_index] = true;
+
+      if(UINT32_MAX == entry->test_valid_watchpoint_index)
+      {
+	valid = valid && (DR_GATHER_NO_SLOT == test->valid_slot);
+      }
+      else
+      {
+	valid = valid && (test->valid_slot < plan->num_slots) &&
+	  (gather_buffer[test->valid_slot] ==
+	   watch_results[entry->test_valid_watchpoint_index]);
+	used[entry->test_valid_watchpoint_index] = true;
+      }
+
+      uint32_t const num_clears =
+	entry->test_latching ? entry->latch_clear.latch_clear_count : 0;
+      valid = valid && (test->num_clears == num_clears);
+
+      for(uint32_t k = 0; (k < num_clears) && valid; ++k)
+      {
+	uint32_t const watchpoint_index =
+	  entry->latch_clear.latch_clear_indices[k];
+	dr_gather_slot_type const slot = plan->clear_slots[test->first_clear + k];
+
+	valid = (slot < plan->num_slots) &&
+	  (gather_buffer[slot] == watch_results[watchpoint_index]);
+	used[watchpoint_index] = true;
+      }
+    }
+  }
+
+  valid = valid && (plan->num_tests == num_active);
+
+  // The plan reads just the watchpoints of the active tests, once each
+  // and in increasing order, and the others have no slot
+  uint32_t num_used = 0;
+
+  for(uint32_t w = 0; (w < NUM_WATCHPOINTS) && valid; ++w)
+  {
+    dr_gather_slot_type const slot = dr_find_gather_slot(plan, w);
+
+    if(used[w])
+    {
+      valid = (slot == num_used) && (plan->watchpoints[slot] == w);
+      ++num_used;
+    }
+    else
+    {
+      valid = (DR_GATHER_NO_SLOT == slot);
+    }
+  }
+
+  return valid && (plan->num_slots == num_used) &&
+    (DR_GATHER_NO_SLOT == dr_find_gather_slot(plan, NUM_WATCHPOINTS)) &&
+    (DR_GATHER_NO_SLOT == dr_find_gather_slot(plan, UINT32_MAX));
+}
+
+static void init_model(dr_model_type * const model)
+{
+  dr_model_storage_type const storage =
+    {
+      MODEL_MAX_TESTS, MODEL_MAX_FAILURE_MODES, MODEL_MAX_NONZEROS,
+      NUM_WATCHPOINTS, model_rows, model_cols,
+      model_row_starts, model_row_tests,
+      model_col_starts, model_col_failure_modes,
+      &model_components, model_gather_watchpoints, model_gather_tests,
+      model_gather_clear_slots
+    };
+
+  dr_init_model(model, &storage);
+}
+
+static void randomize_packed_d_matrix(
+  dr_d_matrix_packed_tbl_type * const packed_tbl,
+  uint32_t const num_tests, uint32_t const num_failure_modes,
+  int const density_percent)
+{
+  uint32_t const row_bytes = DR_D_MATRIX_PACKED_ROW_BYTES(num_tests);
+
+  packed_tbl->header.format = DR_D_MATRIX_PACKED_FORMAT;
+  packed_tbl->header.num_tests = num_tests;
+  packed_tbl->header.num_failure_modes = num_failure_modes;
+  packed_tbl->header.spare = 0;
+  memset(packed_tbl->d_matrix, 0, row_bytes * num_failure_modes);
+
+  for(uint32_t i = 0; i < num_failure_modes; ++i)
+  {
+    for(uint32_t j = 0; j < num_tests; ++j)
+    {
+      if((rand() % 100) < density_percent)
+      {
+	packed_tbl->d_matrix[(i * row_bytes) + (j / 8)] |=
+	  (uint8_t)(1u << (j % 8));
+      }
+    }
+  }
+}
+
+static void fill_valid_wtm(dr_wtm_entry_type wtm[DR_MAX_MODEL_TESTS],
+			   uint32_t const num_tests)
+{
+  for(uint32_t i = 0; i < DR_MAX_MODEL_TESTS; ++i)
+  {
+    dr_wtm_entry_type * const entry = &wtm[i];
+
+    memset(entry, 0, sizeof(*entry));
+    entry->test_index = i % num_tests;
+    entry->watchpoint_index = i % NUM_WATCHPOINTS;
+    entry->test_active = true;
+    entry->test_valid_watchpoint_index = (i + 1) % NUM_WATCHPOINTS;
+    entry->test_type = DR_VALUE_TEST;
+  }
+}
+
+static bool is_model_empty(dr_model_type const * const model,
+			   dr_error_type const error)
+{
+  return (error == model->error) && (error == model->sparse_error) &&
+    (0 == model->num_tests) && (0 == model->num_failure_modes) &&
+    (0 == model->gather_plan.num_slots) &&
+    (0 == model->gather_plan.num_tests);
+}
+
+static bool is_model_d_matrix_equal(
+  dr_model_type const * const model,
+  dr_d_matrix_packed_tbl_type const * const packed_tbl)
+{
+  uint32_t const num_tests = packed_tbl->header.num_tests;
+  uint32_t const num_failure_modes = packed_tbl->header.num_failure_modes;
+  uint32_t num_nonzeros = 0;
+
+  bool equal = (num_tests == model->bitset.num_tests) &&
+    (num_failure_modes == model->bitset.num_failure_modes) &&
+    (num_tests == model->components->num_tests) &&
+    (num_failure_modes == model->components->num_failure_modes);
+
+  for(uint32_t i = 0; (i < num_failure_modes) && equal; ++i)
+  {
+    dr_bitset_word_type const * const row = dr_bitset_row(&(model->bitset), i);
+
+    for(uint32_t j = 0; (j < num_tests) && equal; ++j)
+    {
+      bool const entry = dr_d_matrix_packed_entry(packed_tbl, i, j);
+      dr_bitset_word_type const * const col =
+	dr_bitset_col(&(model->bitset), j);
+
+      equal = (entry == (0 != DR_BITSET_TEST(row, j))) &&
+	(entry == (0 != DR_BITSET_TEST(col, i)));
+      num_nonzeros += entry ? 1 : 0;
+    }
+  }
+
+  // The sparse d-matrix rows list the tests of each row's entries
+  equal = equal && (num_nonzeros == model->sparse.num_nonzeros);
+
+  for(uint32_t i = 0; (i < num_failure_modes) && equal; ++i)
+  {
+    for(uint32_t k = model->sparse.row_starts[i];
+	(k < model->sparse.row_starts[i + 1]) && equal; ++k)
+    {
+      equal = dr_d_matrix_packed_entry(packed_tbl, i,
+				       model->sparse.row_tests[k]);
+    }
+  }
+
+  return equal;
+}
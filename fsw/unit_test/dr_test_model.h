@@ -0,0 +1,47 @@
+#ifndef DR_TEST_MODEL_H
+#define DR_TEST_MODEL_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//////////////////////////////////////////////
+// Public functions
+///////////////////////////////////////////////
+
+// Compiles the gather plans of random watchpoint to test mappings, some
+// entries inactive, with and without validity and latch clear
+// watchpoints, and gathers random watch results through them. Checks
+// that each active test finds in its slots the watch results it would
+// have looked up by watchpoint, that the plan reads exactly the
+// watchpoints of the active tests, once each and in increasing order,
+// and that the other watchpoints, of inactive tests or of none, have
+// no slot.
+// Returns true if the test passed; false otherwise.
+bool test_gather_plan(void);
+
+// Checks that the d-matrix and watchpoint to test mapping tables are
+// refused when the d-matrix header is wrong or too big for the model
+// storage, or an active mapping entry has a test, watchpoint, or test
+// type out of range, or maps to a test past those of the d-matrix, and
+// that a refused compile leaves the model empty with the error. Also
+// checks the entries that are allowed: inactive ones, the latch clear
+// watchpoints of a plain test, and the last test and watchpoint.
+// Returns true if the test passed; false otherwise.
+bool test_model_validation(void);
+
+// Compiles random d-matrices and mappings into a model, and checks
+// that the model has the d-matrix size, every entry of the d-matrix in
+// its bitsets and sparse d-matrix, and the gather plan of the mapping
+// entries of its tests. Also checks that a model emptied by a refused
+// compile compiles again.
+// Returns true if the test passed; false otherwise.
+bool test_model_compile(void);
+
+#ifdef __cplusplus
+}  // extern "C" {
+#endif
+
+#endif // DR_TEST_MODEL_H
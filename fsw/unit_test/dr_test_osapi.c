@@ -0,0 +1,78 @@
+#include "osapi.h"
+
+#include <stdio.h>
+
+///////////////////////////////////////////////////////
+// Constants
+//////////////////////////////////////////////////////
+
+#define MAX_OPEN_FILES 4
+
+///////////////////////////////////////////////////////
+// Private data
+//////////////////////////////////////////////////////
+
+// The files open, indexed by file descriptor
+static FILE * open_files[MAX_OPEN_FILES];
+
+// The calls of OS_write() still to fail
+static uint32 num_failing_writes = 0;
+
+///////////////////////////////////////////////////////
+// Public function definitions
+//////////////////////////////////////////////////////
+
+int32 OS_creat(const char * path, int32 access)
+{
+  (void)access;
+
+  int32 filedes = OS_FS_ERROR;
+
+  for(int32 i = 0; (i < MAX_OPEN_FILES) && (OS_FS_ERROR == filedes); ++i)
+  {
+    if(NULL == open_files[i])
+    {
+      // Only written, as DR saves its results
+      open_files[i] = fopen(path, "wb");
+      filedes = (NULL != open_files[i]) ? i : OS_FS_ERROR;
+    }
+  }
+
+  return filedes;
+}
+
+int32 OS_write(int32 filedes, const void * buffer, uint32 nbytes)
+{
+  int32 result = OS_FS_ERROR;
+
+  if(num_failing_writes > 0)
+  {
+    --num_failing_writes;
+  }
+  else if( (filedes >= 0) && (filedes < MAX_OPEN_FILES) &&
+	   (NULL != open_files[filedes]) )
+  {
+    result = (int32)fwrite(buffer, 1, nbytes, open_files[filedes]);
+  }
+
+  return result;
+}
+
+int32 OS_close(int32 filedes)
+{
+  int32 result = OS_FS_ERROR;
+
+  if( (filedes >= 0) && (filedes < MAX_OPEN_FILES) &&
+      (NULL != open_files[filedes]) )
+  {
+    result = (0 == fclose(open_files[filedes])) ? OS_FS_SUCCESS : OS_FS_ERROR;
+    open_files[filedes] = NULL;
+  }
+
+  return result;
+}
+
+void dr_test_fail_os_writes(uint32 const num_writes)
+{
+  num_failing_writes = num_writes;
+}
@@ -1,91 +1,270 @@
-
-#include <stdio.h>
-#include <stdbool.h>
-#include <stdlib.h>
-#include <time.h>
-
-#include "dr_test_d_matrix_swaps.h"
-#include "dr_test_d_matrix_examples.h"
-#include "dr_test_d_matrix_args.h"
-
-// This would be somewhat easier and more flexible using
-// a unit test framework. However cFS doesn't seem to come with
-// one and I don't want to introduce extra dependencies.
-int main(int argc, char * argv[])
-{
-  int pass_test_count = 0;
-  int fail_test_count = 0;
-
-  // Seed the random number generator
-  srand(time(NULL));
-
-  // Perform the test for wrong number of tests
-  {
-    bool test_passed = test_d_matrix_wrong_num_tests();
-    printf("test_d_matrix_wrong_num_tests(): %s\n",
-	   (test_passed) ? "pass": "fail");
-    (test_passed) ? ++pass_test_count: ++fail_test_count;
-  }
-
-  // Perform the test for wrong number of failure modes
-  {
-    bool test_passed = test_d_matrix_wrong_num_failure_modes();
-    printf("test_d_matrix_wrong_num_failure_modes(): %s\n",
-	   (test_passed) ? "pass": "fail");
-    (test_passed) ? ++pass_test_count: ++fail_test_count;
-  }
-
-  // Perform the test for wrong number of failure modes
-  {
-    bool test_passed = test_d_matrix_invalid_test_results();
-    printf("test_d_matrix_invalid_test_results(): %s\n",
-	   (test_passed) ? "pass": "fail");
-    (test_passed) ? ++pass_test_count: ++fail_test_count;
-  }
-
-  // Perform the swap column order test (test results)
-  {
-    bool test_passed = test_d_matrix_swap_column_order();
-    printf("test_d_matrix_swap_column_order(): %s\n",
-	   (test_passed) ? "pass": "fail");
-    (test_passed) ? ++pass_test_count: ++fail_test_count;
-  }
-  
-  // Perform the swap row order test (failure modes)
-  {
-    bool test_passed = test_d_matrix_swap_row_order();
-    printf("test_d_matrix_swap_row_order(): %s\n",
-	   (test_passed) ? "pass": "fail");
-    (test_passed) ? ++pass_test_count: ++fail_test_count;
-  }
-
-  // Perform the test for example 1 
-  {
-    bool test_passed = test_d_matrix_alg_example_1();
-    printf("test_d_matrix_alg_example_1(): %s\n",
-	   (test_passed) ? "pass": "fail");
-    (test_passed) ? ++pass_test_count: ++fail_test_count;
-  }
-
-  // Perform the test for example 2
-  {
-    bool test_passed = test_d_matrix_alg_example_2();
-    printf("test_d_matrix_alg_example_2(): %s\n",
-	   (test_passed) ? "pass": "fail");
-    (test_passed) ? ++pass_test_count: ++fail_test_count;
-  }
-
-  // Perform the test for bug 001
-  {
-    bool test_passed = test_d_matrix_bug_001();
-    printf("test_d_matrix_bug_001(): %s\n",
-	   (test_passed) ? "pass": "fail");
-    (test_passed) ? ++pass_test_count: ++fail_test_count;
-  }
-
-printf("\n\nDR unit tests: %d passed, %d failed...\n\n", pass_test_count,
-	 fail_test_count);
-  
-  return 0;
-}
-
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "dr_test_d_matrix_swaps.h"
+#include "dr_test_d_matrix_examples.h"
+#include "dr_test_d_matrix_args.h"
+#include "dr_test_d_matrix_engines.h"
+#include "dr_test_log_format.h"
+#include "dr_test_model.h"
+
+// This would be somewhat easier and more flexible using
+// a unit test framework. However cFS doesn't seem to come with
+// one and I don't want to introduce extra dependencies.
+int main(int argc, char * argv[])
+{
+  int pass_test_count = 0;
+  int fail_test_count = 0;
+
+  // Seed the random number generator
+  srand(time(NULL));
+
+  // Perform the test for wrong number of tests
+  {
+    bool test_passed = test_d_matrix_wrong_num_tests();
+    printf("test_d_matrix_wrong_num_tests(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the test for wrong number of failure modes
+  {
+    bool test_passed = test_d_matrix_wrong_num_failure_modes();
+    printf("test_d_matrix_wrong_num_failure_modes(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the test for wrong number of failure modes
+  {
+    bool test_passed = test_d_matrix_invalid_test_results();
+    printf("test_d_matrix_invalid_test_results(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the swap column order test (test results)
+  {
+    bool test_passed = test_d_matrix_swap_column_order();
+    printf("test_d_matrix_swap_column_order(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+  
+  // Perform the swap row order test (failure modes)
+  {
+    bool test_passed = test_d_matrix_swap_row_order();
+    printf("test_d_matrix_swap_row_order(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the test for example 1 
+  {
+    bool test_passed = test_d_matrix_alg_example_1();
+    printf("test_d_matrix_alg_example_1(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the test for example 2
+  {
+    bool test_passed = test_d_matrix_alg_example_2();
+    printf("test_d_matrix_alg_example_2(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the test for bug 001
+  {
+    bool test_passed = test_d_matrix_bug_001();
+    printf("test_d_matrix_bug_001(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the bitset engine comparison test
+  {
+    bool test_passed = test_d_matrix_bitset_engine();
+    printf("test_d_matrix_bitset_engine(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the bitset engine argument checking test
+  {
+    bool test_passed = test_d_matrix_bitset_engine_args();
+    printf("test_d_matrix_bitset_engine_args(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the bitset engine batch test
+  {
+    bool test_passed = test_d_matrix_bitset_engine_batch();
+    printf("test_d_matrix_bitset_engine_batch(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the bit-sliced engine comparison test
+  {
+    bool test_passed = test_d_matrix_sliced_engine();
+    printf("test_d_matrix_sliced_engine(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the exhaustive single fault campaign
+  {
+    bool test_passed = test_d_matrix_single_fault_campaign();
+    printf("test_d_matrix_single_fault_campaign(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the exhaustive double fault campaign
+  {
+    bool test_passed = test_d_matrix_double_fault_campaign();
+    printf("test_d_matrix_double_fault_campaign(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the first pass kernel comparison test
+  {
+    bool test_passed = test_d_matrix_kernels();
+    printf("test_d_matrix_kernels(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the timing statistics test
+  {
+    bool test_passed = test_stats();
+    printf("test_stats(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the binary diagnosis log format test
+  {
+    bool test_passed = test_log_format();
+    printf("test_log_format(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the binary diagnosis log delta record test
+  {
+    bool test_passed = test_log_deltas();
+    printf("test_log_deltas(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the binary diagnosis log round trip test
+  {
+    bool test_passed = test_log_round_trip();
+    printf("test_log_round_trip(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the binary diagnosis log reader test
+  {
+    bool test_passed = test_log_reader();
+    printf("test_log_reader(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the gather plan test
+  {
+    bool test_passed = test_gather_plan();
+    printf("test_gather_plan(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the model validation test
+  {
+    bool test_passed = test_model_validation();
+    printf("test_model_validation(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the model compile test
+  {
+    bool test_passed = test_model_compile();
+    printf("test_model_compile(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the implication count engine comparison test
+  {
+    bool test_passed = test_d_matrix_implication_count_engine();
+    printf("test_d_matrix_implication_count_engine(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the incremental engine comparison test
+  {
+    bool test_passed = test_d_matrix_incremental_engine();
+    printf("test_d_matrix_incremental_engine(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the sparse engine comparison test
+  {
+    bool test_passed = test_d_matrix_sparse_engine();
+    printf("test_d_matrix_sparse_engine(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the sparse engine argument checking test
+  {
+    bool test_passed = test_d_matrix_sparse_engine_args();
+    printf("test_d_matrix_sparse_engine_args(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the component engine comparison test
+  {
+    bool test_passed = test_d_matrix_component_engine();
+    printf("test_d_matrix_component_engine(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the packed d-matrix table test
+  {
+    bool test_passed = test_d_matrix_packed_table();
+    printf("test_d_matrix_packed_table(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+  // Perform the largest model size test
+  {
+    bool test_passed = test_d_matrix_large_model();
+    printf("test_d_matrix_large_model(): %s\n",
+	   (test_passed) ? "pass": "fail");
+    (test_passed) ? ++pass_test_count: ++fail_test_count;
+  }
+
+printf("\n\nDR unit tests: %d passed, %d failed...\n\n", pass_test_count,
+	 fail_test_count);
+  
+  return 0;
+}
+
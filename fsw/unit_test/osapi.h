@@ -0,0 +1,42 @@
+#ifndef DR_UNIT_TEST_OSAPI_H
+#define DR_UNIT_TEST_OSAPI_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Stands in for the OSAL header when the unit tests build the DR
+// sources that save the results, with just the types and file calls
+// those use. dr_test_osapi.c implements the calls with the C library.
+
+typedef int32_t  int32;
+typedef uint8_t  uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+
+#define OS_FS_SUCCESS   0
+#define OS_FS_ERROR   (-1)
+#define OS_ERROR      (-1)
+
+#define OS_WRITE_ONLY   1
+
+int32 OS_creat(const char * path, int32 access);
+int32 OS_write(int32 filedes, const void * buffer, uint32 nbytes);
+int32 OS_close(int32 filedes);
+
+//////////////////////////////////////////////
+// Unit test only
+///////////////////////////////////////////////
+
+// Makes the next num_writes calls of OS_write() fail without writing
+// anything, as a full or failed disk would.
+void dr_test_fail_os_writes(uint32 const num_writes);
+
+#ifdef __cplusplus
+}  // extern "C" {
+#endif
+
+#endif // DR_UNIT_TEST_OSAPI_H